@@ -22,14 +22,19 @@ using namespace linalg::aliases;
 #include "arcball.h"
 #include "hello_imgui/hello_imgui.h"
 #include "misc/cpp/imgui_stdlib.h"
+#include "perf_counters.h"
 #include "renderpass.h"
 #include "shader.h"
 #include <galois++/array2d.h>
 #include <map>
+#include <memory>
 #include <sampler/fwd.h>
 #include <string>
+#include <tuple>
 #include <vector>
 
+class FileWriter;
+
 using std::map;
 using std::ofstream;
 using std::string;
@@ -61,6 +66,46 @@ struct CameraParameters
     float4x4 matrix(float window_aspect) const;
 };
 
+/// A snapshot of everything needed to export the displayed points, so that exports can run in the background
+struct ExportParams
+{
+    Array2d<float>   points; ///< the displayed subset of the points
+    int2             range;  ///< the range of points to draw
+    int              num_dimensions;
+    int3             dimension; ///< the dimensions shown in the 3D view
+    int              point_count, coarse_grid_res;
+    float            radius;
+    float3           point_color;
+    bool             fine_grid, coarse_grid, bbox;
+    bool             compact_svg;
+    int              png_size;
+    bool             png_density;
+    CameraParameters camera[NUM_CAMERA_TYPES];
+    std::string      sampler;
+    uint32_t         seed;
+};
+
+struct ExportTask;
+struct PointTask;
+
+/// The settings the points of a sampler depend on; the cached point columns stay valid while these stay the same
+struct PointSetKey
+{
+    int      sampler = -1, num_points = 0, num_dimensions = 0;
+    uint32_t seed   = 0;
+    float    jitter = 0.f;
+    int      strength = 0, offset_type = -1; ///< of orthogonal arrays; 0 and -1 for other samplers
+
+    /// Whether the points only differ in how many there are, which keeps the first points of infinite sequences
+    bool same_sequence(const PointSetKey &o) const
+    {
+        return sampler == o.sampler && num_dimensions == o.num_dimensions && seed == o.seed && jitter == o.jitter &&
+               strength == o.strength && offset_type == o.offset_type;
+    }
+    bool operator==(const PointSetKey &o) const { return same_sequence(o) && num_points == o.num_points; }
+    bool operator!=(const PointSetKey &o) const { return !(*this == o); }
+};
+
 enum TextAlign : int
 {
     // Horizontal align
@@ -83,13 +128,18 @@ public:
     void run();
 
 private:
-    string export_XYZ_points(const string &format);
-    string export_points_2d(const string &format, CameraType camera, int3 dim);
-    string export_all_points_2d(const string &format);
+    ExportParams export_params() const;
+    void         save_files(const string &basename, const string &ext);
 
     void update_points(bool regenerate = true);
+    void invalidate_points();
+    void request_points(DimensionMask extra_dims = 0);
+    void adopt_points();
+    void finish_points(DimensionMask dims);
+    void cancel_points_task();
     void set_view(CameraType view);
     void draw_editor();
+    void draw_profiler();
     void draw_about_dialog();
     void process_hotkeys();
     bool process_event(void *event);
@@ -102,16 +152,37 @@ private:
     void draw_2D_points_and_grid(const float4x4 &mvp, int2 dims, int plotIndex);
     int2 get_draw_range() const;
 
+    DimensionMask  displayed_dimensions(int num_dims) const;
+    void           reclaim_columns_sampler();
+    void           generate_columns(DimensionMask dims, int first, int count);
+    void           resize_columns(int first);
+    void           generate_missing_dimensions(DimensionMask dims);
+    Array2d<float> subset_points() const;
+
     /// X, Y, Z, and user-defined cameras
     CameraParameters m_camera[NUM_CAMERA_TYPES];
     int              m_view = CAMERA_XY;
 
-    int            m_num_dimensions = 3;
-    int3           m_dimension{0, 1, 2};
-    Array2d<float> m_points, m_subset_points;
-    vector<float3> m_3d_points, m_2d_points;
-    int            m_target_point_count = 256, m_point_count = 256;
-    int            m_subset_count = 0;
+    int                   m_num_dimensions = 3;
+    int3                  m_dimension{0, 1, 2};
+    vector<vector<float>> m_columns;                 ///< one column of coordinates per dimension, empty until generated
+    DimensionMask         m_generated_dims = 0;      ///< the dimensions of m_columns generated so far
+    PointSetKey           m_columns_key;             ///< the settings m_columns were generated for
+    PointSetKey           m_requested_key;           ///< the settings of the points the UI asks for
+    uint64_t              m_columns_version = 0;     ///< incremented whenever already generated coordinates change
+    int                   m_first_changed_point = 0; ///< the points from here on changed since the 3D buffer was built
+    vector<int>           m_subset_indices;          ///< the indices of the points within the coordinate filter
+    vector<float3>        m_3d_points, m_2d_points;
+    bool                  m_2d_points_outdated = true;
+    int                   m_2d_dimensions = 0, m_2d_count = 0; ///< the dimensions and points per plot of m_2d_points
+    int                   m_target_point_count = 256, m_point_count = 256;
+    int                   m_coarse_grid_res = 16;    ///< the points' coarseGridRes(), cached when they are adopted
+    int                   m_subset_count = 0;
+
+    /// The columns version, point count and coordinate filter the subset was last selected with
+    std::tuple<uint64_t, int, bool, int, int, int> m_subset_source{~uint64_t(0), 0, false, 0, 0, 0};
+    /// The XYZ mapping and whether the points were filtered by coordinate when the 3D buffer was built
+    std::tuple<int, int, int, bool> m_3d_points_source{-1, -1, -1, false};
 
     static constexpr int            MAX_DIMENSIONS = 10;
     std::array<int, MAX_DIMENSIONS> m_custom_line_counts;
@@ -139,10 +210,25 @@ private:
     int  m_subset_level      = 0;
 
     bool m_gpu_points_dirty = true, m_cpu_points_dirty = true;
+    int  m_first_new_point  = -1; ///< if >= 0, only points from this index on need to be (re)generated
+    bool m_play_frames      = false;
+    bool m_compact_svg      = false;
+    int  m_png_size         = 2048; ///< width and height of PNG exports, in pixels
+    bool m_png_density      = false;
 
     ImFont *m_regular, *m_bold; // regular and bold fonts at various sizes
 
+    std::unique_ptr<ExportTask> m_export; ///< the export currently running in the background, if any
+
+    std::unique_ptr<PointTask>         m_point_task;      ///< the points being generated in the background, if any
+    vector<std::unique_ptr<PointTask>> m_abandoned_tasks; ///< cancelled tasks that haven't stopped yet
+    std::shared_ptr<Sampler>           m_columns_sampler; ///< the sampler of m_columns, unless from a CSV file
+
+    uint64_t m_profiler_frame = 0; ///< index of the frame shown in the profiler timeline, or 0 for the latest one
+
     float                    m_time1 = 0.f, m_time2 = 0.f;
+    PerfCounters             m_perf_counters; ///< counts the hardware events of generating the points
+    string                   m_perf_summary;  ///< the counts per point, the last time the points were generated
     float3                   m_point_color = {0.9f, 0.55f, 0.1f};
     float3                   m_bg_color    = {0.0f, 0.0f, 0.0f};
     HelloImGui::RunnerParams m_params;
@@ -0,0 +1,94 @@
+/** \file batch.h
+    \author Wojciech Jarosz
+*/
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <galois++/array2d.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Sampler;
+
+/// Create a new instance of the `index`-th sampler listed in the viewer, or return nullptr past the last one
+Sampler *create_sampler(int index, int num_dimensions, float jitter);
+
+/// Create one instance of every sampler, in the order they are listed in the viewer. The caller owns the samplers.
+std::vector<Sampler *> create_samplers(int num_dimensions, float jitter);
+
+/// Settings for generating points from the command line, without the viewer
+struct BatchOptions
+{
+    std::string sampler;              ///< name of the sampler (case insensitive), or a unique prefix of it
+    int64_t     num_points     = 256; ///< the requested number of points; some samplers round this
+    int         num_dimensions = 0;   ///< 0 for 3, or the closest number of dimensions the sampler supports
+    uint32_t    seed           = 0;
+    float       jitter         = -1.f; ///< in percent; negative to keep the sampler's default
+    int         strength       = 0;    ///< strength of orthogonal arrays; 0 to keep the default
+    std::string offset_type;           ///< offset type of orthogonal arrays (name or index); empty for the default
+    int64_t     first = 0;             ///< index of the first point to output
+    int64_t     count = -1;            ///< number of points to output; negative for all remaining points
+    int         shard      = 0;        ///< which of the `num_shards` equal parts of the selected points to output
+    int         num_shards = 0;        ///< 0 to output all selected points
+    std::string format = "csv";        ///< one of "csv", "pts", or "npy"
+    std::string output = "-";          ///< output filename, or "-" for the standard output
+    bool        fixed_point      = false; ///< write 32-bit fixed-point instead of float coordinates (pts and npy only)
+    bool        double_precision = false; ///< write double-precision coordinates (pts and npy only)
+};
+
+/// Return the index (for create_sampler()) of the sampler called `name`, or else of the only one whose name starts
+/// with `name`, ignoring case
+int find_sampler(const std::string &name);
+
+/**
+    Set up `sampler` as described by `options`, in the same order as the viewer does, and return its number of points.
+
+    Only samplers with Sampler::hasLongIndices() can produce more than \f$ 2^{32} \f$ points; asking any other sampler
+    for that many is an error, rather than silently repeating points.
+*/
+int64_t configure_sampler(Sampler *sampler, const BatchOptions &options);
+
+/// Clamp the range of points selected by `options.first` and `options.count` to a set of `num_points` points
+void select_points(const BatchOptions &options, int64_t num_points, int64_t &first, int64_t &count);
+
+/**
+    Write `count` points of dimension `dims` in `options.format` to `options.output`.
+
+    Points are produced in fixed-size blocks by `generate(block, i)`, which fills `block` with the points starting from
+    the i-th one. Each block is generated while the previous one is being written, so the output can be far larger
+    than the available memory.
+*/
+void write_points(const BatchOptions &options, const std::string &sampler_name, int dims, int64_t count,
+                  const std::function<void(Array2d<float> &, int64_t)> &generate);
+
+/// Write points as 32-bit fixed-point coordinates (see Sampler::sampleUInt()), which only the binary formats support
+void write_points(const BatchOptions &options, const std::string &sampler_name, int dims, int64_t count,
+                  const std::function<void(Array2d<uint32_t> &, int64_t)> &generate);
+
+/// Write points as double-precision coordinates (see Sampler::sampleDouble()), which only the binary formats support
+void write_points(const BatchOptions &options, const std::string &sampler_name, int dims, int64_t count,
+                  const std::function<void(Array2d<double> &, int64_t)> &generate);
+
+/// 64-bit FNV-1a hash of `data`, used to check that generated points are intact or unchanged
+uint64_t point_checksum(std::string_view data);
+
+/// Print the names of all samplers to the standard output
+void list_samplers();
+
+/**
+    Generate the points described by `options` and write them out, throwing a std::runtime_error on failure.
+
+    When writing a shard, a manifest with its range and a checksum of its points is written next to it, to the output
+    filename with ".shard" appended.
+*/
+void run_batch(const BatchOptions &options);
+
+/**
+    Check the shards written by run_batch() against their manifests, and that together they cover all selected points.
+
+    Unless `output` is empty, also concatenate them into `output` (as one file of the same format), which then holds
+    exactly the bytes that a single run_batch() without shards would have written.
+*/
+void merge_shards(const std::string &output, const std::vector<std::string> &shards);
@@ -5,23 +5,120 @@
 #pragma once
 
 #include "linalg.h"
+#include <atomic>
+#include <cstdio>
+#include <fmt/format.h>
 #include <galois++/array2d.h>
+#include <sampler/PointFile.h>
 #include <string>
+#include <string_view>
+#include <vector>
 using namespace linalg::aliases;
 
+/// Formats output into a reusable buffer that is written out in large blocks.
+/**
+    Exporters write into this instead of building the whole file in a std::string, so the memory needed to export a
+    point set stays constant regardless of the number of points. Output goes either to a file or, e.g. for browser
+    downloads, to a string.
+*/
+class FileWriter
+{
+public:
+    /**
+        Write to the file `filename`, throwing a std::runtime_error if it cannot be opened.
+
+        If `cancel` is given, writing throws a std::runtime_error as soon as it is set (e.g. from another thread).
+    */
+    explicit FileWriter(const std::string &filename, const std::atomic<bool> *cancel = nullptr);
+    /// Write to the already open `file` (e.g. stdout), which is left open afterwards
+    explicit FileWriter(FILE *file) : m_file(file), m_owns_file(false) {}
+    /// Append to `str`
+    explicit FileWriter(std::string &str) : m_string(&str) {}
+    ~FileWriter();
+
+    FileWriter(const FileWriter &)            = delete;
+    FileWriter &operator=(const FileWriter &) = delete;
+
+    template <typename... Args>
+    void format(fmt::format_string<Args...> format_str, Args &&...args)
+    {
+        fmt::format_to(std::back_inserter(m_buffer), format_str, std::forward<Args>(args)...);
+        if (m_buffer.size() >= BLOCK_SIZE)
+            flush_block();
+    }
+
+    /// Write `data` verbatim; large blocks bypass the buffer
+    void write(std::string_view data);
+
+    FileWriter &operator<<(std::string_view data)
+    {
+        write(data);
+        return *this;
+    }
+
+    /// Write out everything buffered so far
+    void flush();
+
+private:
+    static constexpr size_t BLOCK_SIZE = size_t(1) << 20;
+
+    void write_through(const char *data, size_t size);
+    void flush_block();
+
+    fmt::memory_buffer m_buffer;
+    FILE              *m_file      = nullptr;
+    bool               m_owns_file = true;
+    std::string       *m_string    = nullptr;
+    std::string        m_filename;
+
+    const std::atomic<bool> *m_cancel = nullptr;
+};
+
 // encapsulated postscript file
-std::string header_eps(const float3 &point_color, float radius);
-std::string footer_eps();
-std::string draw_grid_eps(const float4x4 &mvp, int grid_res);
-std::string draw_grids_eps(float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid, bool bbox);
-std::string draw_points_eps(float4x4 mat, int3 dim, const Array2d<float> &points, int2 range);
+void header_eps(FileWriter &out, const float3 &point_color, float radius);
+void footer_eps(FileWriter &out);
+void draw_grid_eps(FileWriter &out, const float4x4 &mvp, int grid_res);
+void draw_grids_eps(FileWriter &out, float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid,
+                    bool bbox);
+void draw_points_eps(FileWriter &out, float4x4 mat, int3 dim, const Array2d<float> &points, int2 range);
 
 // scalable vector graphics file
-std::string header_svg(const float3 &point_color);
-std::string footer_svg();
-std::string draw_grid_svg(const float4x4 &mvp, int grid_res, const std::string &css_class);
-std::string draw_grids_svg(float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid, bool bbox);
-std::string draw_points_svg(float4x4 mat, int3 dim, const Array2d<float> &points, int2 range, float radius);
+void header_svg(FileWriter &out, const float3 &point_color);
+void footer_svg(FileWriter &out);
+void draw_grid_svg(FileWriter &out, const float4x4 &mvp, int grid_res, const std::string &css_class);
+void draw_grids_svg(FileWriter &out, float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid,
+                    bool bbox);
+/// Draw points as individual circles, or (if `compact`) as a single path with quantized relative coordinates that
+/// skips points outside the page
+void draw_points_svg(FileWriter &out, float4x4 mat, int3 dim, const Array2d<float> &points, int2 range, float radius,
+                     bool compact = false);
 
 // comma separated value file
-std::string draw_points_csv(const Array2d<float> &points, int2 range);
+void draw_points_csv(FileWriter &out, const Array2d<float> &points, int2 range);
+
+// binary point-set files: our own .pts format (see PointFileHeader) and numpy's .npy
+void draw_points_pts(FileWriter &out, const Array2d<float> &points, int2 range, const std::string &sampler,
+                     uint32_t seed);
+void draw_points_npy(FileWriter &out, const Array2d<float> &points, int2 range);
+
+/// A square image that plots are rasterized into on the CPU, e.g. to export point sets too large for vector formats
+struct Raster
+{
+    explicit Raster(int size) : size(size), pixels(size_t(size) * size, float4{0.f}) {}
+
+    int                 size;   ///< width and height in pixels
+    std::vector<float4> pixels; ///< premultiplied RGBA, row by row from the top
+};
+
+// portable network graphics file
+void draw_grids_png(Raster &raster, float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid,
+                    bool bbox);
+/**
+    Draw the points as anti-aliased discs, rendering tiles of the image in parallel.
+
+    With `density`, overlapping discs add up instead of occluding each other, and the point color's opacity shows the
+    (logarithmically scaled) accumulated coverage, which reveals the distribution of very dense point sets.
+*/
+void draw_points_png(Raster &raster, float4x4 mat, int3 dim, const Array2d<float> &points, int2 range, float radius,
+                     const float3 &color, bool density = false);
+void write_png(FileWriter &out, const Raster &raster);
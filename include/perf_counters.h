@@ -0,0 +1,60 @@
+/** \file perf_counters.h
+    \author Wojciech Jarosz
+*/
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+/// Hardware event counts of a measured region; counters the CPU or kernel could not provide are empty
+struct PerfCounts
+{
+    std::optional<uint64_t> cycles, instructions, cache_misses, branch_misses;
+
+    /// Whether any counter was measured
+    bool valid() const { return cycles || instructions || cache_misses || branch_misses; }
+
+    /// Instructions per cycle, or 0 if either is unknown
+    double ipc() const { return cycles && instructions && *cycles ? double(*instructions) / *cycles : 0.0; }
+
+    /// Add the counts of another region, e.g. to total several repeats
+    PerfCounts &operator+=(const PerfCounts &other);
+
+    /// A one-line summary of the counts divided by `num_points`, or why there are none
+    std::string per_point_summary(int64_t num_points) const;
+};
+
+/**
+    Counts the CPU cycles, instructions, cache misses and branch misses of the calling thread between start() and
+    stop(), in user space only.
+
+    Uses a Linux perf_event_open() counter group, so all counters cover exactly the same region. Elsewhere, or when
+    the kernel does not allow it (see /proc/sys/kernel/perf_event_paranoid) or the machine has no performance
+    monitoring unit (like many virtual machines), available() is false, error() says why, and stop() returns empty
+    counts.
+*/
+class PerfCounters
+{
+public:
+    PerfCounters();
+    ~PerfCounters();
+
+    PerfCounters(const PerfCounters &)            = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    bool               available() const { return m_fds[0] >= 0; }
+    const std::string &error() const { return m_error; }
+
+    /// Reset the counters and start counting
+    void start();
+
+    /// Stop counting and return the counts since start(), scaled up if the kernel had to multiplex the counters
+    PerfCounts stop();
+
+private:
+    static constexpr int NUM_COUNTERS = 4;
+
+    int         m_fds[NUM_COUNTERS] = {-1, -1, -1, -1}; ///< the first is the group leader
+    std::string m_error;
+};
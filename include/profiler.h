@@ -0,0 +1,103 @@
+/** \file profiler.h
+    \author Wojciech Jarosz
+*/
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+class FileWriter;
+
+/**
+    Records how long named, possibly nested, parts of the viewer take (zones), grouped by the frame they finished in.
+
+    Zones are timed with std::chrono::steady_clock in nanoseconds, and can be recorded from any thread. The most
+    recent frames are kept in a rolling history that can be shown in a timeline, or saved as a Chrome trace (viewable
+    in chrome://tracing or https://ui.perfetto.dev).
+*/
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Zone
+    {
+        const char *name;   ///< must outlive the profiler, so usually a string literal
+        int         depth;  ///< number of enclosing zones on the same thread
+        int         thread; ///< small sequential id of the recording thread, 0 for the first one
+        int64_t     start;  ///< in nanoseconds since the profiler was created
+        int64_t     end;
+    };
+
+    struct Frame
+    {
+        uint64_t          index = 0;
+        int64_t           start = 0, end = 0; ///< in nanoseconds since the profiler was created
+        std::vector<Zone> zones;
+    };
+
+    /// The profiler used throughout the viewer
+    static Profiler &instance();
+
+    /// Finish the current frame, moving it into the history, and start the next one
+    void new_frame();
+
+    /// Stop or resume recording; the history is kept while paused
+    void set_enabled(bool enabled) { m_enabled = enabled; }
+    bool enabled() const { return m_enabled; }
+
+    ///@{ \name Get/set the number of finished frames kept in the history
+    int  history_size() const { return m_history_size; }
+    void set_history_size(int frames);
+    ///@}
+
+    /// A copy of the finished frames in the history, from oldest to newest
+    std::vector<Frame> frames() const;
+
+    /// Write all zones in the history as a Chrome trace event JSON file
+    void write_chrome_trace(FileWriter &out) const;
+
+    /// Nanoseconds elapsed since the profiler was created
+    int64_t now() const { return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_epoch).count(); }
+
+    /// Called by ProfileZone
+    void record(const Zone &zone);
+
+private:
+    Profiler();
+
+    Clock::time_point  m_epoch;
+    std::atomic<bool>  m_enabled{true};
+    int                m_history_size = 240;
+    mutable std::mutex m_mutex; ///< guards the members below
+    Frame              m_current;
+    std::deque<Frame>  m_history;
+};
+
+/**
+    Times the enclosing scope as a zone called `name` in Profiler::instance().
+
+    \code
+    {
+        ProfileZone zone("generate");
+        ...
+    }
+    \endcode
+*/
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char *name);
+    ~ProfileZone();
+
+    ProfileZone(const ProfileZone &)            = delete;
+    ProfileZone &operator=(const ProfileZone &) = delete;
+
+private:
+    const char *m_name;
+    int64_t     m_start = -1; ///< negative if the profiler was disabled when this zone started
+};
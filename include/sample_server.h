@@ -0,0 +1,26 @@
+/** \file sample_server.h
+    \author Wojciech Jarosz
+*/
+#pragma once
+
+#include "batch.h"
+
+#include <string>
+
+/**
+    Serve points to other local processes over the UNIX domain socket at `socket_path`, until interrupted.
+
+    Each request is one line of ';'-separated `key=value` pairs, named like the command-line options: sampler,
+    num-points, dimensions, seed, jitter, strength, offset-type, first, and count. A connection can make any number of
+    requests. Each one is answered with a line that is either "ok <count> <dimensions>" or "error <message>".
+
+    The points are not sent through the socket. An "ok" reply instead carries the file descriptor (as SCM_RIGHTS
+    ancillary data) of an anonymous shared-memory segment that holds them in the .pts layout (see PointFileHeader).
+
+    The most recently used `cache_size` configured samplers are kept alive between requests, so that repeated requests
+    do not pay for their setup and precomputation again.
+*/
+void serve_samples(const std::string &socket_path, int cache_size = 16);
+
+/// Request the points described by `options` from the server at `socket_path`, and write them out like run_batch()
+void request_samples(const std::string &socket_path, const BatchOptions &options);
@@ -15,17 +15,19 @@
 
     Based on the `net-optimize-pointers.cpp` code by Ahmed, which contains no license.
 */
-class BlueNets : public TSamplerDim<2>
+class BlueNets final : public TSamplerDim<2>
 {
 public:
     BlueNets(unsigned n = 2);
 
     void sample(float[], unsigned i) override;
+    void sampleRange(float[], uint64_t first, unsigned count, unsigned stride) override;
 
     std::string name() const override { return "Blue nets"; }
 
     int numSamples() const override { return pointCount; }
     int setNumSamples(unsigned num) override;
+    int roundNumSamples(unsigned num) const override;
 
     uint32_t seed() const override { return m_seed; }
     void     setSeed(uint32_t seed = 0) override
@@ -4,19 +4,68 @@
 #pragma once
 
 #include <galois++/array2d.h>
+#include <memory>
+#include <sampler/MappedFile.h>
+#include <sampler/PointFile.h>
 #include <sampler/Sampler.h>
 #include <string_view>
 
 /// A sampler that reads its data from a comma separated value (CSV) file
+/**
+    By default the entire file is parsed into memory when it is read. In streaming mode the file is instead memory
+    mapped and only indexed up front; rows are parsed on demand into a bounded window that slides along with the
+    requested sample indices. This allows inspecting files that are larger than the available memory.
+
+    Binary point files (.pts, see PointFileHeader, or .npy) are recognized by their header instead. Their float data is
+    used directly from the memory-mapped file without any parsing or copying.
+
+    In watch mode, update() checks whether the file has changed (using inotify on Linux) and parses only the rows that
+    were appended since the last call, which allows following a file while another program is still writing it.
+
+    In sequence mode (see readSequence()) each frame of an animation is stored in its own file. While a frame is shown,
+    a background thread parses the next few frames in the direction of playback into a ring of reusable buffers.
+*/
 class CSVFile : public TSamplerMinMaxDim<1, (unsigned)-1>
 {
 public:
     CSVFile(const std::string &filename = "");
+    ~CSVFile() override;
 
     bool read(const std::string &filename, const std::string_view &data = std::string_view());
 
+    /**
+        Read a sequence of CSV files, one per frame, and show the first one.
+
+        \param pattern Either a printf pattern with the frame number ("frame_%04d.csv", numbered from 0 or 1), or a
+                       glob in the file name ("frame_*.csv"), whose matches are sorted in natural order.
+    */
+    bool readSequence(const std::string &pattern);
+
+    ///@{ \name Get/set the current frame of a sequence
+    unsigned numFrames() const
+    {
+        return (unsigned)m_frames.size();
+    }
+    unsigned frame() const
+    {
+        return m_frame;
+    }
+    bool setFrame(unsigned frame);
+    ///@}
+
+    ///@{ \name Get/set how many upcoming frames of a sequence to parse in the background
+    unsigned prefetchFrames() const
+    {
+        return m_prefetchFrames;
+    }
+    void setPrefetchFrames(unsigned frames);
+    ///@}
+
     void sample(float[], unsigned i) override;
 
+    /// Copy the `count` consecutive rows starting at row `first` into `points`, `stride` floats apart
+    void sampleRange(float points[], uint64_t first, unsigned count, unsigned stride) override;
+
     unsigned dimensions() const override
     {
         return m_numDimensions;
@@ -31,11 +80,77 @@ public:
         return m_numSamples;
     }
 
+    ///@{ \name Get/set whether rows are parsed on demand instead of all at once
+    bool streaming() const
+    {
+        return m_streaming;
+    }
+    void setStreaming(bool streaming);
+    ///@}
+
+    ///@{ \name Get/set the maximum number of rows kept in memory in streaming mode
+    unsigned windowSize() const
+    {
+        return m_windowSize;
+    }
+    void setWindowSize(unsigned rows);
+    ///@}
+
+    ///@{ \name Get/set whether to follow changes to the file (see update())
+    bool watching() const
+    {
+        return m_watching;
+    }
+    void setWatching(bool watching);
+    ///@}
+
+    /**
+        In watch mode, read any rows appended to the file since the last call.
+
+        \returns The index of the first new or changed row (0 if the whole file had to be read again), or -1 if
+                 nothing changed.
+    */
+    int update();
+
+    /// Make rows [first, first + count) resident in streaming mode (up to the window size); a no-op otherwise
+    void prefetch(unsigned first, unsigned count);
+
     std::string name() const override;
 
 protected:
-    std::vector<float> m_values;
+    bool readBinary(MappedFile &&file, std::string_view data, const PointFileInfo &info);
+    void indexRows();
+    void watch();
+    bool loadFrame(unsigned frame);
+    void loadWindow(unsigned first, unsigned count);
+
+    std::vector<float> m_values;         ///< all rows, or just the resident window in streaming mode
+    const float       *m_rows = nullptr; ///< the resident rows: either m_values, or the mapped binary file
     unsigned           m_numDimensions = 0;
     unsigned           m_numSamples    = 0;
     std::string        m_filename;
+
+    // streaming mode
+    static constexpr unsigned ROW_INDEX_STRIDE = 64;
+
+    bool                  m_streaming   = false;
+    unsigned              m_windowSize  = 1u << 18;
+    unsigned              m_windowStart = 0; ///< index of the first resident row
+    unsigned              m_windowRows  = 0; ///< number of resident rows
+    MappedFile            m_file;
+    std::vector<uint64_t> m_rowIndex; ///< byte offset of every ROW_INDEX_STRIDE-th row
+
+    // watch mode
+    bool     m_watching    = false;
+    bool     m_appendable  = false; ///< whether appended rows can be parsed incrementally (in-memory text files)
+    uint64_t m_parsedBytes = 0;     ///< size of the prefix of the file that has been read
+    size_t   m_parsedLines = 0;     ///< number of lines in that prefix
+    int      m_watchHandle = -1;    ///< inotify file descriptor
+
+    // sequence mode
+    struct FramePrefetcher;
+    std::vector<std::string>         m_frames; ///< file names of all frames
+    unsigned                         m_frame          = 0;
+    unsigned                         m_prefetchFrames = 8;
+    std::unique_ptr<FramePrefetcher> m_prefetcher;
 };
@@ -16,12 +16,16 @@
         Victor Ostromoukhov, ACM Transactions on Graphics (Proceedings of SIGGRAPH Asia), 40(6), pp. 274:1–274:13,
         December 2021.
 */
-class CascadedSobol : public TSamplerMinMaxDim<1, 10>
+class CascadedSobol final : public TSamplerMinMaxDim<1, 10>
 {
 public:
     CascadedSobol(const std::string &data_file, unsigned dimensions = 2, unsigned numSamples = 1);
 
     void sample(float[], unsigned i) override;
+    void sampleUInt(uint32_t[], unsigned i) override;
+    void sampleUIntRange(uint32_t[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleDouble(double[], unsigned i) override;
+    void sampleDoubleRange(double[], uint64_t first, unsigned count, unsigned stride) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned n) override;
@@ -33,6 +37,7 @@ public:
 
     int numSamples() const override { return m_numSamples; }
     int setNumSamples(unsigned n) override;
+    int roundNumSamples(unsigned n) const override { return (n == 0) ? 1 : n; }
 
 protected:
     unsigned m_numSamples;
@@ -16,6 +16,7 @@ public:
     Faure(unsigned dimensions = 2, unsigned numSamples = 1);
 
     void sample(float[], unsigned i) override;
+    void sampleDouble(double[], unsigned i) override;
 
     /// Returns an appropriate grid resolution to help visualize stratification
     int coarseGridRes(int samples) const override
@@ -37,6 +38,7 @@ public:
 
     int numSamples() const override { return m_numSamples; }
     int setNumSamples(unsigned n) override;
+    int roundNumSamples(unsigned n) const override { return (n == 0) ? 1 : n; }
 
 protected:
     void     regenerate();
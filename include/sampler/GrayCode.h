@@ -14,17 +14,19 @@
 
     Based on the `gray-code-nets.cpp` code by Ahmed, which contains no license.
 */
-class GrayCode : public TSamplerDim<2>
+class GrayCode final : public TSamplerDim<2>
 {
 public:
     GrayCode(unsigned n = 2);
 
     void sample(float[], unsigned i) override;
+    void sampleRange(float[], uint64_t first, unsigned count, unsigned stride) override;
 
     std::string name() const override { return "Gray code nets"; }
 
     int numSamples() const override { return N; }
     int setNumSamples(unsigned num) override;
+    int roundNumSamples(unsigned num) const override;
 
     uint32_t seed() const override { return m_seed; }
     void     setSeed(uint32_t seed = 0) override
@@ -19,6 +19,8 @@ public:
     ~Halton() override {}
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleDouble(double[], unsigned i) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned) override;
@@ -50,6 +52,8 @@ public:
     ~HaltonZaremba() override {}
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleDouble(double[], unsigned i) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned) override;
@@ -18,15 +18,25 @@ class Hammersley : public BaseHalton
 {
 public:
     Hammersley(unsigned dimensions = 2, unsigned numSamples = 64) :
-        BaseHalton(dimensions - 1), m_numSamples(numSamples), m_inv(1.0f / m_numSamples)
+        BaseHalton(dimensions - 1), m_numSamples(numSamples)
     {
     }
     ~Hammersley() override {}
 
-    void sample(float r[], unsigned i) override
+    void sample(float r[], unsigned i) override { Hammersley::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+    void sampleMasked(float r[], unsigned i, DimensionMask mask) override
+    {
+        if (hasDimension(mask, 0))
+            r[0] = (fixedPointStratum(i, m_numSamples) ^ m_scramble1) * 2.3283064365386962890625e-10f;
+        // shift the mask along with the dimensions, keeping the ones from 64 on selected
+        BaseHalton::sampleMasked(r + 1, i, (mask >> 1) | (DimensionMask(1) << 63));
+    }
+
+    void sampleDouble(double r[], unsigned i) override
     {
-        r[0] = randomDigitScramble(i * m_inv, m_scramble1);
-        BaseHalton::sample(r + 1, i);
+        r[0] = (fixedPointStratum(i, m_numSamples) ^ m_scramble1) * 0x1p-32;
+        BaseHalton::sampleDouble(r + 1, i);
     }
 
     unsigned dimensions() const override { return BaseHalton::dimensions() + 1; }
@@ -46,13 +56,12 @@ public:
     int setNumSamples(unsigned n) override
     {
         m_numSamples = (n == 0) ? 1 : n;
-        m_inv        = 1.0f / m_numSamples;
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override { return (n == 0) ? 1 : n; }
 
 protected:
     unsigned m_numSamples;
-    float    m_inv;
-    unsigned m_scramble1;
+    unsigned m_scramble1 = 0;
     pcg32    m_rand;
 };
@@ -26,6 +26,11 @@ public:
         setNumSamples(sqrtVal, sqrtVal);
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override
+    {
+        int sqrtVal = (n == 0) ? 1 : (int)(std::sqrt((float)n) + 0.5f);
+        return sqrtVal * sqrtVal;
+    }
     void setNumSamples(unsigned x, unsigned y)
     {
         m_resX       = x == 0 ? 1 : x;
@@ -24,13 +24,19 @@
     in P. L'Ecuyer and A. Owen (eds.),
     Monte Carlo and Quasi-Monte Carlo Methods 2008, Springer-Verlag, 2009.
 */
-class LarcherPillichshammerGK : public TSamplerMinMaxDim<1, 1024>
+class LarcherPillichshammerGK final : public TSamplerMinMaxDim<1, 1024>
 {
 public:
     LarcherPillichshammerGK(unsigned dimensions = 2, unsigned numSamples = 64, uint32_t seed = 0);
     ~LarcherPillichshammerGK() override;
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleRangeMasked(float[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask) override;
+    void sampleUInt(uint32_t[], unsigned i) override;
+    void sampleUIntRange(uint32_t[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleDouble(double[], unsigned i) override;
+    void sampleDoubleRange(double[], uint64_t first, unsigned count, unsigned stride) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
 
@@ -42,9 +48,9 @@ public:
     int setNumSamples(unsigned n) override
     {
         m_numSamples = (n == 0) ? 1 : n;
-        m_inv        = 1.0f / m_numSamples;
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override { return (n == 0) ? 1 : n; }
 
     uint32_t seed() const override { return m_seed; }
     void     setSeed(uint32_t seed = 0) override
@@ -63,7 +69,6 @@ public:
 
 protected:
     uint32_t m_numSamples, m_numDimensions;
-    float    m_inv;
     uint32_t m_seed = 0;
     pcg32    m_rand;
     uint32_t m_scramble1, m_scramble2, m_scramble3;
@@ -0,0 +1,54 @@
+/** \file MappedFile.h
+    \author Wojciech Jarosz
+*/
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/// A read-only view of an entire file's contents.
+/**
+    Uses `mmap` (or `MapViewOfFile` on Windows) so that the operating system pages the file in on demand without any
+    intermediate copies. On platforms without memory mapping (e.g. emscripten) the file is read into memory with a
+    single read call instead.
+*/
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string &filename) { open(filename); }
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile &)            = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept { *this = std::move(other); }
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /// Map the file `filename` into memory, throwing a std::runtime_error on failure
+    void open(const std::string &filename);
+    /// Unmap the file
+    void close();
+
+    /// Hint that bytes [offset, offset + length) will be read soon, so the OS can start paging them in asynchronously
+    void prefetch(size_t offset, size_t length) const;
+
+    bool             is_open() const { return m_open; }
+    const char      *data() const { return m_data; }
+    size_t           size() const { return m_size; }
+    std::string_view view() const { return {m_data, m_size}; }
+
+    const std::string &filename() const { return m_filename; }
+
+private:
+    std::string m_filename;
+    const char *m_data = nullptr;
+    size_t      m_size = 0;
+    bool        m_open = false;
+
+#if defined(_WIN32)
+    void *m_file = nullptr, *m_mapping = nullptr;
+#endif
+    std::vector<char> m_fallback; ///< holds the file contents if we couldn't map it
+};
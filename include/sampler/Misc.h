@@ -180,6 +180,25 @@ inline int iLog2(T f)
     return iLog2(float(f));
 }
 
+/// Reposition a random number generator at the random numbers of the `i`-th point
+/**
+    Samplers that jitter their points draw the same number of random numbers for every point. Jumping straight to
+    point `i` (in O(log i) time) yields exactly the numbers reached by generating points 0 through i-1 first, so that
+    points can be generated in any order, or split across several processes.
+
+    \param rand     The generator to reposition.
+    \param start    The state of the generator before the first point.
+    \param i        The index of the point about to be generated.
+    \param perPoint The number of random numbers drawn for each point.
+*/
+template <typename RNG>
+inline void seekPoint(RNG &rand, const RNG &start, uint64_t i, unsigned perPoint)
+{
+    rand = start;
+    // wraps around modulo 2^64, just like the generator's state
+    rand.advance(int64_t(i * perPoint));
+}
+
 /// In-place pseudo-random number in [0,1)
 /**
     Based on method described in the tech report:
@@ -301,6 +320,10 @@ inline float randomDigitScramble(float f, unsigned scramble)
     return (unsigned(f * 0x100000000LL) ^ scramble) * 2.3283064365386962890625e-10f;
 }
 
+/// The stratum i/n (for i < n) as 32-bit fixed point, rounded down. Unlike i * (1.f / n), this keeps all strata of
+/// more than \f$ 2^{24} \f$ points apart, and never rounds up to 1.
+inline uint32_t fixedPointStratum(uint64_t i, uint64_t n) { return uint32_t((i << 32) / n); }
+
 inline unsigned LarcherPillichshammerRIU(unsigned n, unsigned scramble = 0)
 {
     for (unsigned v = 1U << 31; n; n >>= 1, v |= v >> 1)
@@ -407,4 +430,15 @@ inline float foldedRadicalInverse(int n, int base, float inv)
     return v;
 }
 
+/// Double-precision version, which adds digits until they no longer change a double
+inline double foldedRadicalInverse(int n, int base, double inv)
+{
+    double   v         = 0;
+    unsigned modOffset = 0;
+
+    for (double p = inv; v + base * p != v; p *= inv, n /= base, ++modOffset) v += ((n + modOffset) % base) * p;
+
+    return v;
+}
+
 inline float foldedRadicalInverse(int n, int base) { return foldedRadicalInverse(n, base, 1.0f / base); }
@@ -26,6 +26,7 @@ public:
 
     void reset() override;
     void sample(float[], unsigned i) override;
+    void sampleRange(float[], uint64_t first, unsigned count, unsigned stride) override;
 
     uint32_t seed() const override { return m_seed; }
     void     setSeed(uint32_t seed = 0) override
@@ -46,6 +47,11 @@ public:
         setNumSamples(sqrtVal, sqrtVal);
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override
+    {
+        int sqrtVal = (n == 0) ? 1 : (int)(std::sqrt((float)n) + 0.5f);
+        return sqrtVal * sqrtVal;
+    }
     void setNumSamples(unsigned x, unsigned y)
     {
         m_resX       = x;
@@ -106,6 +112,11 @@ public:
         setNumSamples(sqrtVal, sqrtVal);
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override
+    {
+        int sqrtVal = (n == 0) ? 1 : (int)(std::sqrt((float)n) + 0.5f);
+        return sqrtVal * sqrtVal;
+    }
     void setNumSamples(unsigned x, unsigned y)
     {
         m_resX       = x;
@@ -130,7 +141,7 @@ protected:
     Pixar Technical Memo 13-01.
 
 */
-class CorrelatedMultiJittered : public MultiJittered
+class CorrelatedMultiJittered final : public MultiJittered
 {
 public:
     CorrelatedMultiJittered(unsigned, unsigned, uint32_t seed = 0, float jitter = 0.0f);
@@ -170,6 +181,11 @@ public:
         setNumSamples(sqrtVal, sqrtVal);
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override
+    {
+        int sqrtVal = (n == 0) ? 1 : (int)(std::sqrt((float)n) + 0.5f);
+        return sqrtVal * sqrtVal;
+    }
     void setNumSamples(unsigned x, unsigned y)
     {
         m_resX       = x;
@@ -17,6 +17,7 @@ public:
 
     void reset() override;
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned d) override
@@ -43,6 +44,7 @@ public:
         reset();
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override { return n; }
 
 protected:
     unsigned m_numSamples;
@@ -54,6 +56,7 @@ protected:
 
     std::vector<RandomPermutation> m_permutations;
     pcg32                          m_rand;
+    pcg32                          m_jitterStart; ///< state of m_rand before jittering the first point
 };
 
 /// An in-place version of correlated multi-jittered point sets.
@@ -71,6 +74,7 @@ public:
 
     void reset() override;
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned d) override
@@ -90,6 +94,7 @@ public:
         reset();
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override { return n; }
 
     uint32_t seed() const override { return m_seed; }
     void     setSeed(uint32_t seed = 0) override
@@ -16,7 +16,7 @@
 
     > R.C. Bose (1938) Sankhya Vol 3, pp 323-338.
  */
-class BoseOA : public OrthogonalArray
+class BoseOA final : public OrthogonalArray
 {
 public:
     BoseOA(unsigned, OffsetType ot = CENTERED, uint32_t seed = 0, float jitter = 0.0f, unsigned dimensions = 2);
@@ -28,6 +28,9 @@ public:
 
     void reset() override;
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleRange(float[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleRangeMasked(float[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned d) override
@@ -41,6 +44,7 @@ public:
     int  numSamples() const override { return m_numSamples; }
     int  setNumSamples(unsigned n) override;
     void setNumSamples(unsigned x, unsigned);
+    int  roundNumSamples(unsigned n) const override;
 
 protected:
     unsigned m_s, m_numSamples;
@@ -73,6 +77,7 @@ public:
 
     virtual void reset();
     virtual void sample(float[], unsigned i);
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     virtual unsigned dimensions() const { return m_numDimensions; }
     virtual void     setDimensions(unsigned d)
@@ -86,6 +91,7 @@ public:
     virtual int  numSamples() const { return m_numSamples; }
     virtual int  setNumSamples(unsigned n);
     virtual void setNumSamples(unsigned x, unsigned y);
+    virtual int  roundNumSamples(unsigned n) const;
 
 protected:
     unsigned m_s, m_numSamples, m_numDimensions;
@@ -100,9 +106,11 @@ public:
                       unsigned dimensions = 2);
 
     void        sample(float[], unsigned i) override;
+    void        sampleMasked(float[], unsigned i, DimensionMask mask) override;
     std::string name() const override;
     int         setNumSamples(unsigned n) override;
     void        setNumSamples(unsigned x, unsigned y) override;
+    int         roundNumSamples(unsigned n) const override;
 
 protected:
     unsigned m_numDigits = 1;
@@ -129,9 +137,11 @@ public:
     unsigned setStrength(unsigned) override { return 2; }
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     std::string name() const override;
     int         setNumSamples(unsigned n) override;
+    int         roundNumSamples(unsigned n) const override;
 
 protected:
     Galois::Field m_gf;
@@ -28,9 +28,11 @@ public:
     int coarseGridRes(int samples) const override { return int(std::sqrt(0.5f * samples)); }
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     std::string name() const override;
     int         setNumSamples(unsigned n) override;
+    int         roundNumSamples(unsigned n) const override;
 
 protected:
     Array2d<float> m_B;
@@ -58,7 +60,9 @@ public:
     int coarseGridRes(int samples) const override { return int(std::sqrt(0.5f * samples)); }
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     std::string name() const override;
     int         setNumSamples(unsigned n) override;
+    int         roundNumSamples(unsigned n) const override;
 };
\ No newline at end of file
@@ -36,11 +36,13 @@ public:
     int coarseGridRes(int samples) const override { return int(std::pow(samples, 1.f / m_t)); }
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     std::string name() const override;
 
     int  setNumSamples(unsigned n) override;
     void setNumSamples(unsigned x, unsigned y) override;
+    int  roundNumSamples(unsigned n) const override;
 };
 
 /// Produces OA samples based on the construction by Bush (1952).
@@ -69,11 +71,13 @@ public:
     ~BushGaloisOAInPlace() override {}
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
 
     std::string name() const override;
 
     int  setNumSamples(unsigned n) override;
     void setNumSamples(unsigned x, unsigned y) override;
+    int  roundNumSamples(unsigned n) const override;
 
 protected:
     Galois::Field m_gf;
@@ -22,6 +22,7 @@ public:
     ~CMJNDInPlace() override;
 
     void sample(float point[], unsigned i) override;
+    void sampleMasked(float point[], unsigned i, DimensionMask mask) override;
 
     /// Resets the permutation seeds
     void reset() override;
@@ -0,0 +1,67 @@
+/** \file PointFile.h
+    \author Wojciech Jarosz
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/// The 64-byte header of a binary point-set file (".pts").
+/**
+    The header is followed directly by `num_points * num_dimensions` little-endian values of type `dtype`, stored
+    point by point. Since the data starts at a 64-byte offset, a memory-mapped file can be used in place.
+*/
+struct PointFileHeader
+{
+    enum DataType : uint32_t
+    {
+        Float32 = 0, ///< IEEE single-precision coordinates in [0,1)
+        UInt32  = 1, ///< 32-bit fixed-point coordinates, where v represents v / 2^32
+        Float64 = 2  ///< IEEE double-precision coordinates in [0,1)
+    };
+
+    /// Size in bytes of one value of type `dtype`
+    static constexpr size_t valueSize(uint32_t dtype) { return dtype == Float64 ? 8 : 4; }
+
+    static constexpr char     MAGIC[4] = {'S', 'S', 'P', 'T'};
+    static constexpr uint32_t VERSION  = 1;
+
+    char     magic[4];
+    uint32_t version;
+    uint64_t num_points;
+    uint32_t num_dimensions;
+    uint32_t dtype;
+    uint32_t seed;        ///< seed of the sampler that generated the points
+    uint32_t reserved;
+    char     sampler[32]; ///< null-padded name of the sampler that generated the points
+};
+static_assert(sizeof(PointFileHeader) == 64, "PointFileHeader must be 64 bytes");
+
+/// Description of the point array stored in a .pts or .npy file
+struct PointFileInfo
+{
+    uint64_t    numPoints     = 0;
+    uint32_t    numDimensions = 0;
+    uint32_t    dtype         = PointFileHeader::Float32;
+    size_t      dataOffset    = 0; ///< byte offset of the first value from the start of the file
+    std::string sampler;
+    uint32_t    seed = 0;
+};
+
+/**
+    Parse the header of a binary point file (either our own .pts format or a numpy .npy file).
+
+    \param data     The (beginning of the) contents of the file
+    \param info     Set to the description of the stored points on success
+    \returns        false if `data` is not in either format. Throws a std::runtime_error if it is, but is malformed or
+                    uses an unsupported data type.
+*/
+bool parsePointFileHeader(std::string_view data, PointFileInfo &info);
+
+/// Return the header of a .pts file storing `n` points of dimension `d` with values of type `dtype`
+std::string pointFileHeader(uint64_t n, uint32_t d, uint32_t dtype, const std::string &sampler, uint32_t seed);
+
+/// Return the header of a .npy file storing an `n` x `d` C-ordered array with values of type `dtype`
+std::string npyHeader(uint64_t n, uint32_t d, uint32_t dtype);
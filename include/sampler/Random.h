@@ -13,6 +13,13 @@ public:
     Random(unsigned dimensions = 2, uint64_t seed = PCG32_DEFAULT_STATE);
 
     void sample(float[], unsigned i) override;
+    void sample64(float[], uint64_t i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleRangeMasked(float[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask) override;
+    bool hasLongIndices() const override
+    {
+        return true;
+    }
 
     unsigned dimensions() const override
     {
@@ -20,6 +27,10 @@ public:
     }
     void setDimensions(unsigned) override;
 
+    /// Seed 0 stands for pcg32's default state, which the points were generated with before they could be seeded
+    uint32_t seed() const override;
+    void     setSeed(uint32_t seed = 0) override;
+
     std::string name() const override
     {
         return "Random";
@@ -27,5 +38,6 @@ public:
 
 protected:
     unsigned m_numDimensions;
+    uint64_t m_seed;
     pcg32    m_rand;
 };
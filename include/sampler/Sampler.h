@@ -3,9 +3,21 @@
 */
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <sampler/fwd.h>
 #include <string>
+#include <vector>
+
+/// Convert a coordinate in [0,1) to 32-bit fixed point, where v represents \f$ v / 2^{32} \f$
+inline uint32_t toFixedPoint(float f) { return uint32_t(std::clamp(double(f) * 4294967296.0, 0.0, 4294967295.0)); }
+
+/// The DimensionMask that selects every dimension
+constexpr DimensionMask ALL_DIMENSIONS = ~DimensionMask(0);
+
+/// Whether `mask` selects dimension `d`
+inline bool hasDimension(DimensionMask mask, unsigned d) { return d >= 64 || (mask >> d) & 1; }
 
 /// Abstract class providing a common API to multi-dimensional (quasi-)random
 /// number generators.
@@ -38,6 +50,13 @@ public:
         return -1;
     }
 
+    /// Return the number of samples setNumSamples(`n`) would result in, without setting up the point set
+    /**
+        Lets callers tell how many points to expect before a possibly slow setup. Returns -1 for infinite sequences,
+        and 0 if the number can't be told without the setup.
+    */
+    virtual int roundNumSamples(unsigned n) const { return numSamples() < 0 ? -1 : 0; }
+
     ///@{ \name Get/set the point set dimensionality
     virtual unsigned dimensions() const = 0;
     virtual void     setDimensions(unsigned) { ; }
@@ -58,6 +77,96 @@ public:
     /// Compute the `i`-th sample in the sequence and store in the `point` array
     virtual void sample(float point[], unsigned i) = 0;
 
+    /// Whether sample64() yields new points past index \f$ 2^{32}-1 \f$, instead of repeating or rounding to the same
+    /// single-precision points
+    virtual bool hasLongIndices() const { return false; }
+
+    /// Compute the `i`-th sample of a sequence with more than \f$ 2^{32} \f$ points (see hasLongIndices())
+    virtual void sample64(float point[], uint64_t i) { sample(point, unsigned(i)); }
+
+    /// Compute the `count` samples starting at index `first`, storing the `k`-th one at `points + k * stride`
+    /**
+        Gives the same points as calling sample64() for each index, but samplers with cheap points override it (with
+        sampleRangeInline()) to avoid a virtual call per point. Dimensions past dimensions() are left untouched when
+        `stride` is larger.
+    */
+    virtual void sampleRange(float points[], uint64_t first, unsigned count, unsigned stride)
+    {
+        if (hasLongIndices())
+            for (unsigned k = 0; k < count; ++k) sample64(points + size_t(k) * stride, first + k);
+        else
+            for (unsigned k = 0; k < count; ++k) sample(points + size_t(k) * stride, unsigned(first + k));
+    }
+
+    /// Compute only the dimensions of the `i`-th sample selected by `mask`
+    /**
+        Lets callers that use a few of many dimensions (like the 3D view) skip the cost of the others. Samplers that
+        compute each dimension separately override this (along with sampleRangeMasked()) and leave the other
+        coordinates untouched; the selected ones are the same as those of sample(). By default, all dimensions are
+        computed.
+    */
+    virtual void sampleMasked(float point[], unsigned i, DimensionMask mask) { sample(point, i); }
+
+    /// Compute the dimensions selected by `mask` of a range of samples, like sampleRange() does for all of them
+    virtual void sampleRangeMasked(float points[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask)
+    {
+        if (mask == ALL_DIMENSIONS || hasLongIndices())
+            sampleRange(points, first, count, stride);
+        else
+            for (unsigned k = 0; k < count; ++k) sampleMasked(points + size_t(k) * stride, unsigned(first + k), mask);
+    }
+
+    /// Compute the `i`-th sample as 32-bit fixed-point coordinates (see toFixedPoint())
+    /**
+        Digital nets and sequences override this (along with sampleUIntRange()) to return the integer coordinates
+        they compute internally, without rounding them to float. By default, the coordinates of sample() are
+        converted.
+    */
+    virtual void sampleUInt(uint32_t point[], unsigned i) { sampleUIntRange(point, i, 1, dimensions()); }
+
+    /// Compute a range of samples as 32-bit fixed-point coordinates, like sampleRange() does for floats
+    virtual void sampleUIntRange(uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+    {
+        thread_local std::vector<float> buffer;
+        buffer.resize(size_t(count) * stride);
+        sampleRange(buffer.data(), first, count, stride);
+        unsigned dims = std::min(dimensions(), stride);
+        for (size_t k = 0; k < count; ++k)
+            for (unsigned d = 0; d < dims; ++d) points[k * stride + d] = toFixedPoint(buffer[k * stride + d]);
+    }
+
+    /// Compute the `i`-th sample in double precision
+    /**
+        Single-precision coordinates of different points start to coincide past about \f$ 2^{24} \f$ points. Samplers
+        that compute more bits than a float holds (Halton and the digital nets) override this to return all of them.
+        By default, the coordinates of sample() are converted.
+    */
+    virtual void sampleDouble(double point[], unsigned i)
+    {
+        thread_local std::vector<float> buffer;
+        buffer.resize(dimensions());
+        sample(buffer.data(), i);
+        std::copy(buffer.begin(), buffer.end(), point);
+    }
+
+    /// Compute a range of samples in double precision, like sampleRange() does for floats
+    virtual void sampleDoubleRange(double points[], uint64_t first, unsigned count, unsigned stride)
+    {
+        if (!hasLongIndices())
+        {
+            for (unsigned k = 0; k < count; ++k) sampleDouble(points + size_t(k) * stride, unsigned(first + k));
+            return;
+        }
+
+        thread_local std::vector<float> buffer;
+        buffer.resize(dimensions());
+        for (unsigned k = 0; k < count; ++k)
+        {
+            sample64(buffer.data(), first + k);
+            std::copy(buffer.begin(), buffer.end(), points + size_t(k) * stride);
+        }
+    }
+
     /// Return a human-readible name for the sampler
     virtual std::string name() const { return "Abstract Sampler"; }
 };
@@ -109,3 +218,74 @@ public:
 
     std::string name() const override { return "Abstract TSamplerDim"; }
 };
+
+/// Loop over the points of a range with `sample(point, i)`, with a fixed stride if `STRIDE` is not 0
+template <unsigned STRIDE, typename T, typename F>
+inline void sampleRangeStride(T points[], unsigned first, unsigned count, unsigned stride, F &&sample)
+{
+    const size_t step = STRIDE ? STRIDE : stride;
+    for (unsigned k = 0; k < count; ++k) sample(points + k * step, first + k);
+}
+
+/// Loop over the points of a range with `sample(point, i)`, handling the common strides with separate loops
+template <typename T, typename F>
+inline void sampleRangeWith(T points[], uint64_t first, unsigned count, unsigned stride, F &&sample)
+{
+    switch (stride)
+    {
+    case 2: sampleRangeStride<2>(points, unsigned(first), count, stride, sample); break;
+    case 3: sampleRangeStride<3>(points, unsigned(first), count, stride, sample); break;
+    case 4: sampleRangeStride<4>(points, unsigned(first), count, stride, sample); break;
+    case 8: sampleRangeStride<8>(points, unsigned(first), count, stride, sample); break;
+    default: sampleRangeStride<0>(points, unsigned(first), count, stride, sample); break;
+    }
+}
+
+/// Implements Sampler::sampleRange() with non-virtual calls to S::sample()
+/**
+    Call this from the sampleRange() override of `S` in the same source file that defines `S::sample()`, so that the
+    compiler can inline it into the loop. The common strides are handled by separate loops with the stride known at
+    compile time, so that the dimension loops of fixed-dimension samplers can be unrolled.
+
+    Since the sample() of subclasses is bypassed, `S` should be final, or its subclasses must not override sample().
+*/
+template <class S>
+inline void sampleRangeInline(S &sampler, float points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeWith(points, first, count, stride, [&sampler](float *p, unsigned i) { sampler.S::sample(p, i); });
+}
+
+/// Implements Sampler::sampleRangeMasked() with non-virtual calls to S::sampleMasked(), like sampleRangeInline()
+template <class S>
+inline void sampleRangeMaskedInline(S &sampler, float points[], uint64_t first, unsigned count, unsigned stride,
+                                    DimensionMask mask)
+{
+    sampleRangeWith(points, first, count, stride,
+                    [&sampler, mask](float *p, unsigned i) { sampler.S::sampleMasked(p, i, mask); });
+}
+
+/// Implements Sampler::sampleUIntRange() with non-virtual calls to S::sampleUInt(), like sampleRangeInline()
+template <class S>
+inline void sampleUIntRangeInline(S &sampler, uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeWith(points, first, count, stride,
+                    [&sampler](uint32_t *p, unsigned i) { sampler.S::sampleUInt(p, i); });
+}
+
+/// Implements Sampler::sampleDoubleRange() with non-virtual calls to S::sampleDouble(), like sampleRangeInline()
+template <class S>
+inline void sampleDoubleRangeInline(S &sampler, double points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeWith(points, first, count, stride,
+                    [&sampler](double *p, unsigned i) { sampler.S::sampleDouble(p, i); });
+}
+
+/// Implements Sampler::sampleDouble() by scaling the fixed-point coordinates of S::sampleUInt(), all of whose 32 bits
+/// fit into a double
+template <class S>
+inline void sampleDoubleFromUInt(S &sampler, double point[], unsigned i)
+{
+    uint32_t fixed[S::MAX_DIMENSION];
+    sampler.S::sampleUInt(fixed, i);
+    for (unsigned d = 0; d < sampler.S::dimensions(); ++d) point[d] = fixed[d] * 0x1p-32;
+}
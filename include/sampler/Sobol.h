@@ -11,12 +11,18 @@
 /**
     A wrapper for L. Gruenschloss's fast Sobol sampler.
 */
-class Sobol : public TSamplerMinMaxDim<1, 1024>
+class Sobol final : public TSamplerMinMaxDim<1, 1024>
 {
 public:
     Sobol(unsigned dimensions = 2);
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleRangeMasked(float[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask) override;
+    void sampleUInt(uint32_t[], unsigned i) override;
+    void sampleUIntRange(uint32_t[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleDouble(double[], unsigned i) override;
+    void sampleDoubleRange(double[], uint64_t first, unsigned count, unsigned stride) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned n) override
@@ -38,13 +44,19 @@ protected:
 };
 
 /// A (0,2) sequence created by padding the first two dimensions of Sobol
-class ZeroTwo : public TSamplerMinMaxDim<1, 1024>
+class ZeroTwo final : public TSamplerMinMaxDim<1, 1024>
 {
 public:
     ZeroTwo(unsigned n = 64, unsigned dimensions = 2, bool shuffle = false);
 
     void reset() override;
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleRangeMasked(float[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask) override;
+    void sampleUInt(uint32_t[], unsigned i) override;
+    void sampleUIntRange(uint32_t[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleDouble(double[], unsigned i) override;
+    void sampleDoubleRange(double[], uint64_t first, unsigned count, unsigned stride) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned d) override
@@ -62,6 +74,7 @@ public:
 
     int numSamples() const override { return m_numSamples; }
     int setNumSamples(unsigned n) override;
+    int roundNumSamples(unsigned n) const override { return (n == 0) ? 1 : n; }
 
     std::string name() const override { return m_shuffle ? "Shuffled+XORed (0,2)" : "XORed (0,2)"; }
 
@@ -84,6 +97,8 @@ public:
     SSobol(unsigned dimensions = 2);
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleDouble(double[], unsigned i) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned n) override
@@ -119,6 +134,8 @@ public:
     ZSobol(unsigned dimensions = 2);
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleDouble(double[], unsigned i) override;
 
     int numSamples() const override { return m_numSamples; }
     int setNumSamples(unsigned n) override
@@ -129,12 +146,17 @@ public:
         reset();
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override { return n; }
 
     void reset() override;
 
     std::string name() const override { return "Blue-noise Sobol"; }
 
 protected:
+    /// Implements sample(), sampleMasked() and sampleDouble()
+    template <typename T>
+    void samplePrecision(T r[], unsigned i, DimensionMask mask);
+
     uint64_t shuffled_morton_index(uint32_t morton_index, uint32_t num_base_4_digits, uint32_t dimension);
 
     uint32_t m_numSamples;
@@ -155,13 +177,19 @@ protected:
 
     \ingroup Samplers
 */
-class OneTwo : public TSamplerMinMaxDim<1, 1024>
+class OneTwo final : public TSamplerMinMaxDim<1, 1024>
 {
 public:
     OneTwo(unsigned n = 64, unsigned dimensions = 2, uint32_t seed = 0);
 
     void reset() override;
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
+    void sampleRangeMasked(float[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask) override;
+    void sampleUInt(uint32_t[], unsigned i) override;
+    void sampleUIntRange(uint32_t[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleDouble(double[], unsigned i) override;
+    void sampleDoubleRange(double[], uint64_t first, unsigned count, unsigned stride) override;
 
     unsigned dimensions() const override { return m_numDimensions; }
     void     setDimensions(unsigned d) override
@@ -179,6 +207,7 @@ public:
 
     int numSamples() const override { return m_numSamples; }
     int setNumSamples(unsigned n) override;
+    int roundNumSamples(unsigned n) const override { return (n == 0) ? 1 : n; }
 
     std::string name() const override { return "(1,2) Sobol"; }
 
@@ -18,6 +18,7 @@ public:
     int coarseGridRes(int samples) const override { return std::pow(samples, 0.25f); }
 
     void sample(float[], unsigned i) override;
+    void sampleMasked(float[], unsigned i, DimensionMask mask) override;
     int  numSamples() const override { return m_numSamples; }
     int  setNumSamples(unsigned n) override
     {
@@ -28,6 +29,13 @@ public:
         setNumSamples((int)ceil(sv), std::max(1, (int)floor(sv)));
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override
+    {
+        int   v      = std::max(1, (int)round(std::pow((float)n, 0.5f)));
+        float sv     = std::sqrt(v);
+        int   digits = (int)ceil(sv) * std::max(1, (int)floor(sv));
+        return digits * digits;
+    }
     void setNumSamples(unsigned x, unsigned y)
     {
         m_resX       = x;
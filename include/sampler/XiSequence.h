@@ -15,12 +15,17 @@
     "Analysis and Synthesis of Digital Dyadic Sequences."
     In ACM Trans. Graph. (Proceedings of SIGGRAPH Asia 2023), 42(6), doi:10.1145/3618308.
 */
-class XiSequence : public TSamplerDim<2>
+class XiSequence final : public TSamplerDim<2>
 {
 public:
     XiSequence(unsigned n = 1);
 
     void sample(float[], unsigned i) override;
+    void sampleRange(float[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleUInt(uint32_t[], unsigned i) override;
+    void sampleUIntRange(uint32_t[], uint64_t first, unsigned count, unsigned stride) override;
+    void sampleDouble(double[], unsigned i) override;
+    void sampleDoubleRange(double[], uint64_t first, unsigned count, unsigned stride) override;
 
     std::string name() const override { return "Xi (0,m,2)-sequence"; }
 
@@ -30,6 +35,7 @@ public:
         m_numSamples = roundUpPow2(n);
         return m_numSamples;
     }
+    int roundNumSamples(unsigned n) const override { return roundUpPow2(n); }
 
     uint32_t seed() const override { return m_seed; }
     void     setSeed(uint32_t seed = 0) override;
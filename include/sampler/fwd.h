@@ -9,8 +9,14 @@
 
 #pragma once
 
+#include <cstdint>
+
 /* Forward declarations */
 class Sampler;
+
+/// A set of dimensions to compute, where bit `d` selects dimension `d`; dimensions from 64 on are always selected
+using DimensionMask = uint64_t;
+
 template <unsigned MIN_D, unsigned MAX_D> class TSamplerMinMaxDim;
 template <unsigned DIM> class TSamplerDim;
 class RandomPermutation;
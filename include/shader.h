@@ -124,6 +124,22 @@ public:
         set_buffer(name, get_type<T>(), 1, shape, data.data());
     }
 
+    /**
+        Upload a vertex buffer like set_buffer(), but keep its first `first` rows from the previous upload.
+
+        Only the remaining rows are uploaded, and the buffer's capacity grows geometrically, so a buffer that grows
+        by appending rows uploads each row only a constant number of times on average.
+     */
+    void update_buffer(const std::string &name, VariableType type, size_t ndim, const size_t *shape, const void *data,
+                       size_t first);
+
+    template <typename T, int M>
+    void update_buffer(const std::string &name, const std::vector<linalg::vec<T, M>> &vecs, size_t first)
+    {
+        size_t shape[3] = {vecs.size(), M, 1};
+        update_buffer(name, get_type<T>(), 2, shape, vecs.data(), first);
+    }
+
     // set_uniform
     template <typename T, int M>
     void set_uniform(const std::string &name, const linalg::vec<T, M> &value)
@@ -253,6 +269,7 @@ protected:
         size_t       ndim   = 0;
         size_t       shape[3]{0, 0, 0};
         size_t       size             = 0;
+        size_t       capacity         = 0; ///< bytes allocated for a vertex buffer, see update_buffer()
         size_t       instance_divisor = 0;
         size_t       pointer_offset   = 0;
         bool         dirty            = false;
@@ -8,7 +8,7 @@
 
 #include <chrono>
 
-//! Simple timer with millisecond precision
+//! Simple timer with sub-millisecond precision
 /*!
     This class is convenient for collecting performance data
 */
@@ -24,26 +24,24 @@ public:
     //! Reset the timer to the current time
     void reset()
     {
-        start = std::chrono::system_clock::now();
+        start = std::chrono::steady_clock::now();
     }
 
     //! Return the number of milliseconds elapsed since the timer was last reset
     double elapsed() const
     {
-        auto now      = std::chrono::system_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
-        return (double)duration.count();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
     }
 
     //! Return the number of milliseconds elapsed since the timer was last reset and then reset it
     double lap()
     {
-        auto now      = std::chrono::system_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
+        auto now      = std::chrono::steady_clock::now();
+        auto duration = std::chrono::duration<double, std::milli>(now - start);
         start         = now;
-        return (double)duration.count();
+        return duration.count();
     }
 
 private:
-    std::chrono::system_clock::time_point start;
+    std::chrono::steady_clock::time_point start;
 };
@@ -15,32 +15,23 @@
 #include "opengl_check.h"
 
 #include <sampler/CSVFile.h>
-#include <sampler/CascadedSobol.h>
-#include <sampler/Faure.h>
-#include <sampler/GrayCode.h>
-#include <sampler/Halton.h>
-#include <sampler/Hammersley.h>
-#include <sampler/Jittered.h>
-#include <sampler/LP.h>
-#include <sampler/Misc.h>
-#include <sampler/MultiJittered.h>
-#include <sampler/NRooks.h>
 #include <sampler/OA.h>
-#include <sampler/OAAddelmanKempthorne.h>
-#include <sampler/OABoseBush.h>
-#include <sampler/OABush.h>
-#include <sampler/OACMJND.h>
-#include <sampler/Random.h>
-#include <sampler/Sobol.h>
-#include <sampler/Sudoku.h>
-#include <sampler/XiSequence.h>
 
+#include "batch.h"
+#include "sample_server.h"
 #include "export_to_file.h"
+#include "profiler.h"
 #include "timer.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <filesystem>
 #include <fmt/core.h>
 #include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
 #include <utility>
 
 #ifdef __EMSCRIPTEN__
@@ -59,6 +50,186 @@ using namespace linalg::ostream_overloads;
 
 using std::pair;
 using std::to_string;
+namespace fs = std::filesystem;
+
+/// Writes a set of files on a pool of background threads, with progress reporting and cancellation
+struct ExportTask
+{
+    struct Job
+    {
+        string                            filename;
+        std::function<void(FileWriter &)> write;
+    };
+
+    vector<Job>         jobs;
+    std::atomic<int>    next{0}, done{0}, running{0};
+    std::atomic<bool>   cancelled{false};
+    vector<string>      errors; ///< guarded by mutex until all workers have finished
+    std::mutex          mutex;
+    vector<std::thread> workers;
+
+    explicit ExportTask(vector<Job> &&jobs_) : jobs(std::move(jobs_))
+    {
+#ifndef __EMSCRIPTEN__
+        int num_workers = std::clamp((int)std::thread::hardware_concurrency(), 1, (int)jobs.size());
+        running         = num_workers;
+        for (int i = 0; i < num_workers; ++i) workers.emplace_back(&ExportTask::work, this);
+#else
+        running = 1;
+        work();
+#endif
+    }
+
+    ~ExportTask()
+    {
+        cancelled = true;
+        for (auto &worker : workers) worker.join();
+    }
+
+    bool finished() const { return running == 0; }
+
+    void work()
+    {
+        for (int j; !cancelled && (j = next++) < (int)jobs.size();)
+        {
+            try
+            {
+                ProfileZone zone("export file");
+                FileWriter  out(jobs[j].filename, &cancelled);
+                jobs[j].write(out);
+                ++done;
+                continue;
+            }
+            catch (const std::exception &e)
+            {
+                if (!cancelled)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    errors.push_back(e.what());
+                }
+            }
+            // don't leave partially written files behind
+            std::error_code ec;
+            fs::remove(jobs[j].filename, ec);
+        }
+        --running;
+    }
+};
+
+/**
+    Generate the coordinates of points [first, first + count) of `sampler` in the dimensions `dims` into
+    `columns[d][i - offset]`, which must already be large enough.
+
+    Stops early if `cancelled` gets set, and adds the number of points generated so far to `done`.
+*/
+static void sample_columns(Sampler *sampler, int num_dimensions, DimensionMask dims, int first, int count,
+                           vector<vector<float>> &columns, int offset, const std::atomic<bool> *cancelled = nullptr,
+                           std::atomic<int> *done = nullptr)
+{
+    // the samplers write whole points, so generate cache-sized blocks of points and scatter them into the columns
+    constexpr int BLOCK_SIZE = 1024;
+    vector<float> block(size_t(BLOCK_SIZE) * num_dimensions, 0.5f);
+    for (int start = first; start < first + count; start += BLOCK_SIZE)
+    {
+        if (cancelled && *cancelled)
+            return;
+
+        int n = std::min(BLOCK_SIZE, first + count - start);
+        sampler->sampleRangeMasked(block.data(), start, n, num_dimensions, dims);
+        for (int d = 0; d < num_dimensions; ++d)
+            if (hasDimension(dims, d))
+                for (int i = 0; i < n; ++i) columns[d][start - offset + i] = block[size_t(i) * num_dimensions + d];
+        if (done)
+            *done += n;
+    }
+}
+
+/**
+    Generates points on a background thread, with progress reporting and cancellation.
+
+    The task sets up its own instance of the sampler, since that can take longer than generating the points, and the UI
+    can keep changing the viewer's samplers in the meantime. Tasks that only add to the cached points instead continue
+    with the sampler those were generated with.
+*/
+struct PointTask
+{
+    PointSetKey              key;     ///< the settings of the points
+    BatchOptions             options; ///< the same settings, to set up the task's sampler with
+    std::shared_ptr<Sampler> sampler; ///< lent, or else set up by the task and only read by others once finished
+    const bool               lent;    ///< whether `sampler` is that of the cached points, which is already set up
+    DimensionMask            dims;    ///< the dimensions to generate
+    int                      first;   ///< the first point to generate; all points up to num_points follow
+    vector<vector<float>>    columns; ///< the coordinates of the generated points, empty for dimensions not in `dims`
+    std::atomic<int>         num_points; ///< the number of points, exact once the sampler is set up
+    std::atomic<int>         done{0};    ///< the number of points generated so far
+    std::atomic<bool>        cancelled{false}, finished{false};
+    string                   error, perf_summary; ///< set once finished
+    float                    setup_time = 0.f, time = 0.f; ///< how long the setup and generating took, in ms
+    std::thread              worker;
+
+    PointTask(const PointSetKey &key_, const BatchOptions &options_, std::shared_ptr<Sampler> sampler_,
+              DimensionMask dims_, int first_) :
+        key(key_), options(options_), sampler(std::move(sampler_)), lent(sampler != nullptr), dims(dims_),
+        first(first_),
+        num_points(lent && sampler->numSamples() >= 0 ? sampler->numSamples() : key.num_points)
+    {
+#ifndef __EMSCRIPTEN__
+        worker = std::thread(&PointTask::work, this);
+#else
+        work();
+#endif
+    }
+
+    ~PointTask()
+    {
+        cancelled = true;
+        wait();
+    }
+
+    int count() const { return num_points - first; }
+
+    void wait()
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+
+    void work()
+    {
+        try
+        {
+            ProfileZone zone("generate points");
+            Timer       timer;
+            if (!lent)
+            {
+                ProfileZone setup_zone("set up sampler");
+                sampler.reset(create_sampler(key.sampler, options.num_dimensions, key.jitter * 0.01f));
+                num_points = (int)configure_sampler(sampler.get(), options);
+            }
+            setup_time = timer.elapsed();
+            timer.reset();
+
+            columns.resize(key.num_dimensions);
+            for (int d = 0; d < key.num_dimensions && !cancelled; ++d)
+                if (hasDimension(dims, d))
+                    columns[d].assign(count(), 0.5f);
+
+            PerfCounters counters;
+            counters.start();
+            sample_columns(sampler.get(), key.num_dimensions, dims, first, count(), columns, first, &cancelled, &done);
+            PerfCounts counts = counters.stop();
+            perf_summary      = counters.available() ? counts.per_point_summary(count()) : counters.error();
+            time              = timer.elapsed();
+        }
+        catch (const std::exception &e)
+        {
+            error = e.what();
+        }
+        finished = true;
+    }
+};
+
+static void export_XYZ_points(FileWriter &out, const string &format, const ExportParams &p);
 
 static int g_dismissed_version = 0;
 
@@ -127,37 +298,7 @@ SampleViewer::SampleViewer()
 {
     m_custom_line_counts.fill(1);
 
-    m_samplers.emplace_back(new Random(m_num_dimensions));
-    m_samplers.emplace_back(new Jittered(1, 1, m_jitter * 0.01f));
-    m_samplers.emplace_back(new CorrelatedMultiJitteredInPlace(1, 1, m_num_dimensions, 0, m_jitter * 0.01f, false));
-    m_samplers.emplace_back(new CorrelatedMultiJitteredInPlace(1, 1, m_num_dimensions, 0, m_jitter * 0.01f, true));
-    m_samplers.emplace_back(new CMJNDInPlace(1, 3, MJ_STYLE, 0, m_jitter * 0.01f));
-    m_samplers.emplace_back(new SudokuInPlace(1, 1, m_num_dimensions, 0, 0.0f, false));
-    m_samplers.emplace_back(new SudokuInPlace(1, 1, m_num_dimensions, 0, 0.0f, true));
-    m_samplers.emplace_back(new BoseOAInPlace(1, MJ_STYLE, 0, m_jitter * 0.01f, m_num_dimensions));
-    m_samplers.emplace_back(new BoseGaloisOAInPlace(1, MJ_STYLE, 0, m_jitter * 0.01f, m_num_dimensions));
-    m_samplers.emplace_back(new BushOAInPlace(1, 3, MJ_STYLE, 0, m_jitter * 0.01f, m_num_dimensions));
-    m_samplers.emplace_back(new BushGaloisOAInPlace(1, 3, MJ_STYLE, 0, m_jitter * 0.01f, m_num_dimensions));
-    m_samplers.emplace_back(new AddelmanKempthorneOAInPlace(2, MJ_STYLE, 0, m_jitter * 0.01f, m_num_dimensions));
-    m_samplers.emplace_back(new BoseBushOAInPlace(2, MJ_STYLE, 0, m_jitter * 0.01f, m_num_dimensions));
-    m_samplers.emplace_back(new NRooksInPlace(m_num_dimensions, 1, 0, m_jitter * 0.01f));
-    m_samplers.emplace_back(new Sobol(m_num_dimensions));
-    m_samplers.emplace_back(new SSobol(m_num_dimensions));
-    m_samplers.emplace_back(new ZSobol(m_num_dimensions));
-    m_samplers.emplace_back(new ZeroTwo(1, m_num_dimensions, false));
-    m_samplers.emplace_back(new ZeroTwo(1, m_num_dimensions, true));
-    m_samplers.emplace_back(
-        new CascadedSobol(HelloImGui::assetFileFullPath("cascaded_sobol_init_tab.dat"), m_num_dimensions));
-    m_samplers.emplace_back(new OneTwo(1, m_num_dimensions, 0));
-    m_samplers.emplace_back(new Faure(m_num_dimensions, 1));
-    m_samplers.emplace_back(new Halton(m_num_dimensions));
-    m_samplers.emplace_back(new HaltonZaremba(m_num_dimensions));
-    m_samplers.emplace_back(new Hammersley<Halton>(m_num_dimensions, 1));
-    m_samplers.emplace_back(new Hammersley<HaltonZaremba>(m_num_dimensions, 1));
-    m_samplers.emplace_back(new LarcherPillichshammerGK(3, 1, false));
-    m_samplers.emplace_back(new GrayCode(1));
-    m_samplers.emplace_back(new XiSequence(1));
-    m_samplers.emplace_back(new CSVFile());
+    m_samplers = create_samplers(m_num_dimensions, m_jitter * 0.01f);
 
     m_camera[CAMERA_XY].arcball.set_state({0, 0, 0, 1});
     m_camera[CAMERA_XY].persp_factor = 0.0f;
@@ -208,10 +349,18 @@ SampleViewer::SampleViewer()
     consoleWindow.rememberIsVisible = true;
     consoleWindow.GuiFunction       = [] { HelloImGui::LogGui(); };
 
+    // A timeline of how long each part of the recent frames took, sharing the space of the console
+    HelloImGui::DockableWindow profilerWindow;
+    profilerWindow.label             = "Profiler";
+    profilerWindow.dockSpaceName     = "ConsoleSpace";
+    profilerWindow.isVisible         = false;
+    profilerWindow.rememberIsVisible = true;
+    profilerWindow.GuiFunction       = [this] { draw_profiler(); };
+
     // docking layouts
     {
         m_params.dockingParams.layoutName      = "Settings on left";
-        m_params.dockingParams.dockableWindows = {editorWindow, consoleWindow};
+        m_params.dockingParams.dockableWindows = {editorWindow, consoleWindow, profilerWindow};
 
         HelloImGui::DockingSplit splitMainConsole{"MainDockSpace", "ConsoleSpace", ImGuiDir_Down, 0.25f};
 
@@ -221,18 +370,19 @@ SampleViewer::SampleViewer()
         HelloImGui::DockingParams right_layout, portrait_layout, landscape_layout;
 
         right_layout.layoutName      = "Settings on right";
-        right_layout.dockableWindows = {editorWindow, consoleWindow};
+        right_layout.dockableWindows = {editorWindow, consoleWindow, profilerWindow};
         right_layout.dockingSplits   = {HelloImGui::DockingSplit{"MainDockSpace", "EditorSpace", ImGuiDir_Right, 0.2f},
                                         splitMainConsole};
 
-        consoleWindow.dockSpaceName = "EditorSpace";
+        consoleWindow.dockSpaceName  = "EditorSpace";
+        profilerWindow.dockSpaceName = "EditorSpace";
 
         portrait_layout.layoutName      = "Mobile device (portrait orientation)";
-        portrait_layout.dockableWindows = {editorWindow, consoleWindow};
+        portrait_layout.dockableWindows = {editorWindow, consoleWindow, profilerWindow};
         portrait_layout.dockingSplits = {HelloImGui::DockingSplit{"MainDockSpace", "EditorSpace", ImGuiDir_Down, 0.5f}};
 
         landscape_layout.layoutName      = "Mobile device (landscape orientation)";
-        landscape_layout.dockableWindows = {editorWindow, consoleWindow};
+        landscape_layout.dockableWindows = {editorWindow, consoleWindow, profilerWindow};
         landscape_layout.dockingSplits   = {
             HelloImGui::DockingSplit{"MainDockSpace", "EditorSpace", ImGuiDir_Left, 0.5f}};
 
@@ -285,49 +435,27 @@ SampleViewer::SampleViewer()
 
     m_params.callbacks.ShowAppMenuItems = [this]()
     {
-        auto save_files = [this](const string &basename, const string &ext)
-        {
-            vector<string> saved_files;
-            if (ext == "csv")
-            {
-                HelloImGui::Log(HelloImGui::LogLevel::Info, "Saving to: %s.", basename.c_str());
-                saved_files.push_back(basename);
-                ofstream csv_file(saved_files.back());
-                csv_file << draw_points_csv(m_subset_points, get_draw_range());
-            }
-            else
-            {
-                HelloImGui::Log(HelloImGui::LogLevel::Info, "Saving to base filename: %s.", basename.c_str());
-
-                saved_files.push_back(basename + "_all2D." + ext);
-                ofstream fileAll(saved_files.back());
-                fileAll << export_all_points_2d(ext);
-
-                saved_files.push_back(basename + "_012." + ext);
-                ofstream fileXYZ(saved_files.back());
-                fileXYZ << export_XYZ_points(ext);
-
-                for (int y = 0; y < m_num_dimensions; ++y)
-                    for (int x = 0; x < y; ++x)
-                    {
-                        saved_files.push_back(fmt::format("{:s}_{:d}{:d}.{}", basename, x, y, ext));
-                        ofstream fileXY(saved_files.back());
-                        fileXY << export_points_2d(ext, CAMERA_XY, {x, y, 2});
-                    }
-            }
-            return saved_files;
-        };
-
-        for (string ext : {"eps", "svg", "csv"})
+        ImGui::MenuItem("Compact SVG points", nullptr, &m_compact_svg);
+        tooltip("Write the points of SVG exports as a single path with coordinates rounded to 1/10 of a pixel, "
+                "skipping points outside the plot. This makes exports of large point sets much smaller and faster to "
+                "open.");
+        ImGui::MenuItem("PNG point density", nullptr, &m_png_density);
+        tooltip("Let overlapping points in PNG exports add up, showing the density of the points instead of just their "
+                "coverage.");
+        ImGui::SliderInt("PNG size", &m_png_size, 256, 8192, "%d px",
+                         ImGuiSliderFlags_Logarithmic | ImGuiSliderFlags_AlwaysClamp);
+
+        for (string ext : {"eps", "svg", "png", "csv", "pts", "npy"})
         {
 #ifndef __EMSCRIPTEN__
-            if (ImGui::MenuItem(fmt::format("{}  Export as {}...", ICON_FA_FLOPPY_DISK, to_upper(ext))))
+            if (ImGui::MenuItem(fmt::format("{}  Export as {}...", ICON_FA_FLOPPY_DISK, to_upper(ext)), nullptr,
+                                false, !m_export))
             {
                 try
                 {
                     auto basename = pfd::save_file("Base filename").result();
                     if (!basename.empty())
-                        (void)save_files(basename, ext);
+                        save_files(basename, ext);
                 }
                 catch (const std::exception &e)
                 {
@@ -346,10 +474,25 @@ SampleViewer::SampleViewer()
                     try
                     {
                         ImGui::CloseCurrentPopup();
-                        string buffer = draw_points_csv(m_subset_points, get_draw_range());
+                        finish_points(ALL_DIMENSIONS);
+                        bool   binary = ext == "pts" || ext == "npy" || ext == "png";
+                        string buffer;
+                        {
+                            FileWriter out(buffer);
+                            if (ext == "png")
+                                export_XYZ_points(out, ext, export_params());
+                            else if (ext == "pts")
+                                draw_points_pts(out, subset_points(), get_draw_range(), m_samplers[m_sampler]->name(),
+                                                m_seed);
+                            else if (ext == "npy")
+                                draw_points_npy(out, subset_points(), get_draw_range());
+                            else
+                                draw_points_csv(out, subset_points(), get_draw_range());
+                        }
                         emscripten_browser_file::download(
-                            "test_file.csv", // the default filename for the browser to save.
-                            "text/csv", // the MIME type of the data, treated as if it were a webserver serving a file
+                            // the default filename for the browser to save, and the MIME type of the data
+                            binary ? "test_file." + ext : "test_file.csv",
+                            ext == "png" ? "image/png" : binary ? "application/octet-stream" : "text/csv",
                             string_view(buffer.c_str(), buffer.length()) // a buffer describing the data to download
                         );
                         // vector<string> saved_files = save_files(basename, ext);
@@ -375,10 +518,49 @@ SampleViewer::SampleViewer()
     {
         ImGui::SetCursorPosY(ImGui::GetCursorPosY() - ImGui::GetFontSize() * 0.15f);
         ImGui::Text("%3.3f / %3.3f ms (%3.0f pps)", m_time2, m_time1 + m_time2, m_point_count / (m_time1 + m_time2));
-        tooltip("Shows A/B (points per second) where A is how long it took to call Sampler::sample(), and B includes "
-                "other setup costs.");
+        tooltip(fmt::format("Shows A/B (points per second) where A is how long it took to call Sampler::sample(), and B "
+                            "includes other setup costs.\n\nHardware counters: {}",
+                            m_perf_counters.available() ? m_perf_summary : m_perf_counters.error())
+                    .c_str());
         // ImGui::SameLine();
-        ImGui::SameLine(ImGui::GetIO().DisplaySize.x - 16.f * ImGui::GetFontSize());
+
+        if (m_point_task)
+        {
+            int done = m_point_task->done, total = m_point_task->count();
+            ImGui::SameLine();
+            ImGui::ProgressBar(total > 0 ? float(done) / total : 0.f, float2{12.f * ImGui::GetFontSize(), 0.f},
+                               fmt::format("Generating {}/{}", done, total).c_str());
+            tooltip("Points are generated in the background; the last completed points are shown until they are done.");
+        }
+
+        if (m_export)
+        {
+            int done = m_export->done, total = (int)m_export->jobs.size();
+            if (m_export->finished())
+            {
+                for (auto &error : m_export->errors)
+                    HelloImGui::Log(HelloImGui::LogLevel::Error, "An error occurred while exporting: %s.",
+                                    error.c_str());
+                HelloImGui::Log(HelloImGui::LogLevel::Info, "Exported %d of %d files.", done, total);
+                m_export.reset();
+            }
+            else
+            {
+                ImGui::SameLine();
+                ImGui::ProgressBar(float(done) / total, float2{12.f * ImGui::GetFontSize(), 0.f},
+                                   fmt::format("Exporting {}/{}", done, total).c_str());
+                ImGui::SameLine();
+                if (ImGui::SmallButton(ICON_FA_XMARK))
+                    m_export->cancelled = true;
+                tooltip("Cancel the export");
+            }
+        }
+
+        ImGui::SameLine(ImGui::GetIO().DisplaySize.x - 18.f * ImGui::GetFontSize());
+        ImGui::SetCursorPosY(ImGui::GetCursorPosY() - ImGui::GetFontSize() * 0.15f);
+        ImGui::ToggleButton(ICON_FA_STOPWATCH, &m_params.dockingParams.dockableWindows[2].isVisible);
+        tooltip("Show the profiler");
+        ImGui::SameLine();
         ImGui::SetCursorPosY(ImGui::GetCursorPosY() - ImGui::GetFontSize() * 0.15f);
         ImGui::ToggleButton(ICON_FA_TERMINAL, &m_params.dockingParams.dockableWindows[1].isVisible);
     };
@@ -433,6 +615,7 @@ SampleViewer::SampleViewer()
             HelloImGui::SaveUserPref("AboutDismissedVersion", to_string(version_combined()));
     };
 
+    m_params.callbacks.PreNewFrame             = []() { Profiler::instance().new_frame(); };
     m_params.callbacks.ShowGui                 = [this]() { draw_about_dialog(); };
     m_params.callbacks.CustomBackground        = [this]() { draw_background(); };
     m_params.callbacks.AnyBackendEventCallback = [this](void *event) { return process_event(event); };
@@ -447,13 +630,12 @@ SampleViewer::~SampleViewer()
 
 int2 SampleViewer::get_draw_range() const
 {
-    int start = 0, count = m_point_count;
-    if (m_subset_by_coord)
-        count = std::min(count, m_subset_count);
-    else if (m_subset_by_index)
+    // the subset matches the 3D buffer, which keeps the last completed points while new ones are generated
+    int start = 0, count = m_subset_count;
+    if (m_subset_by_index)
     {
-        start = m_first_draw_point;
-        count = std::min(m_point_draw_count, m_point_count - m_first_draw_point);
+        start = std::min(m_first_draw_point, count);
+        count = std::min(m_point_draw_count, count - start);
     }
     return {start, count};
 }
@@ -722,24 +904,88 @@ void SampleViewer::draw_editor()
                     HelloImGui::Log(HelloImGui::LogLevel::Debug, "Loading file '%s' of mime type '%s' ...",
                                     filename.c_str(), mime_type.c_str());
                     s_csv_file->read(filename, buffer);
-                    that->m_gpu_points_dirty = that->m_cpu_points_dirty = true;
+                    that->invalidate_points();
                 };
 
                 // open the browser's file selector, and pass the file to the upload handler
-                emscripten_browser_file::upload(".csv,.txt", handle_upload_file, this);
+                emscripten_browser_file::upload(".csv,.txt,.pts,.npy", handle_upload_file, this);
                 HelloImGui::Log(HelloImGui::LogLevel::Debug, "Requesting file from user");
 #else
-                auto result = pfd::open_file("Open CSV file", "", {"CSV files", "*.csv *.txt"}).result();
+                auto result = pfd::open_file("Open point file", "",
+                                             {"Point files", "*.csv *.txt *.pts *.npy", "CSV files", "*.csv *.txt",
+                                              "Binary point files", "*.pts *.npy"})
+                                  .result();
                 if (!result.empty())
                 {
                     HelloImGui::Log(HelloImGui::LogLevel::Debug, "Loading file '%s'...", result.front().c_str());
-                    csv->read(result.front());
-                    m_gpu_points_dirty = m_cpu_points_dirty = true;
+                    try
+                    {
+                        csv->read(result.front());
+                    }
+                    catch (const std::exception &e)
+                    {
+                        HelloImGui::Log(HelloImGui::LogLevel::Error, "Could not read '%s': %s.",
+                                        result.front().c_str(), e.what());
+                    }
+                    invalidate_points();
                 }
 #endif
             }
             tooltip("Load points from a CSV text file with points for rows and individual point coordinates as comma "
-                    "separated values per row.");
+                    "separated values per row, or from a binary .pts or .npy file.");
+#ifndef __EMSCRIPTEN__
+            ImGui::SameLine();
+            bool streaming = csv->streaming();
+            if (ImGui::ToggleButton(ICON_FA_HARD_DRIVE, &streaming))
+            {
+                csv->setStreaming(streaming);
+                invalidate_points();
+            }
+            tooltip("Stream points from disk instead of loading the whole file. Only a window of rows around the "
+                    "displayed points (see \"Filter by point index\") is kept in memory, which allows viewing files "
+                    "larger than RAM.");
+
+            ImGui::SameLine();
+            bool watching = csv->watching();
+            if (ImGui::ToggleButton(ICON_FA_ARROWS_ROTATE, &watching))
+            {
+                csv->setWatching(watching);
+                m_gpu_points_dirty = m_cpu_points_dirty = true;
+            }
+            tooltip("Watch the file for changes, and read new rows as they are appended to it.");
+
+            static string s_pattern;
+            if (ImGui::InputTextWithHint("Frames", "frame_%04d.csv or frame_*.csv", &s_pattern,
+                                         ImGuiInputTextFlags_EnterReturnsTrue))
+            {
+                try
+                {
+                    csv->readSequence(s_pattern);
+                }
+                catch (const std::exception &e)
+                {
+                    HelloImGui::Log(HelloImGui::LogLevel::Error, "Could not read sequence '%s': %s.",
+                                    s_pattern.c_str(), e.what());
+                }
+                m_play_frames = false;
+                invalidate_points();
+            }
+            tooltip("Load a sequence of CSV files, one per frame, using a printf pattern or a wildcard in the file "
+                    "name. Upcoming frames are read in the background while a frame is shown.");
+
+            if (csv->numFrames() > 1)
+            {
+                ImGui::ToggleButton(m_play_frames ? ICON_FA_PAUSE : ICON_FA_PLAY, &m_play_frames);
+                tooltip("Play back the frames of the sequence.");
+                ImGui::SameLine();
+                int frame = csv->frame();
+                if (ImGui::SliderInt("Frame", &frame, 0, csv->numFrames() - 1))
+                {
+                    csv->setFrame(frame);
+                    invalidate_points();
+                }
+            }
+#endif
         }
 
         int num_points = m_point_count;
@@ -781,7 +1027,7 @@ void SampleViewer::draw_editor()
                 if ((unsigned)strength != oa->strength())
                 {
                     oa->setStrength(strength);
-                    m_gpu_points_dirty = m_cpu_points_dirty = true;
+                    invalidate_points();
                 }
             };
             int strength = oa->strength();
@@ -794,8 +1040,8 @@ void SampleViewer::draw_editor()
             auto change_offset_type = [oa, this](int offset)
             {
                 oa->setOffsetType(offset);
-                m_jitter           = oa->jitter();
-                m_gpu_points_dirty = m_cpu_points_dirty = true;
+                m_jitter = oa->jitter();
+                invalidate_points();
             };
             if (ImGui::BeginCombo("Offset type", offset_names[oa->offsetType()].c_str()))
             {
@@ -982,6 +1228,157 @@ void SampleViewer::draw_editor()
     ImGui::ScrollWhenDraggingOnVoid(ImVec2(0.0f, -ImGui::GetIO().MouseDelta.y), ImGuiMouseButton_Left);
 }
 
+void SampleViewer::draw_profiler()
+{
+    auto &profiler = Profiler::instance();
+    bool  enabled  = profiler.enabled();
+    if (ImGui::Checkbox("Record", &enabled))
+        profiler.set_enabled(enabled);
+    tooltip("Record how long each part of every frame takes. The most recent frames are kept.");
+
+    ImGui::SameLine();
+#ifndef __EMSCRIPTEN__
+    if (ImGui::Button(ICON_FA_FLOPPY_DISK " Save Chrome trace..."))
+    {
+        try
+        {
+            auto filename = pfd::save_file("Save Chrome trace", "trace.json", {"JSON files", "*.json"}).result();
+            if (!filename.empty())
+            {
+                FileWriter out(filename);
+                profiler.write_chrome_trace(out);
+                HelloImGui::Log(HelloImGui::LogLevel::Info, "Saved the profile to %s.", filename.c_str());
+            }
+        }
+        catch (const std::exception &e)
+        {
+            HelloImGui::Log(HelloImGui::LogLevel::Error, "Could not save the profile: %s.", e.what());
+        }
+    }
+#else
+    if (ImGui::Button(ICON_FA_FLOPPY_DISK " Download Chrome trace"))
+    {
+        string buffer;
+        {
+            FileWriter out(buffer);
+            profiler.write_chrome_trace(out);
+        }
+        emscripten_browser_file::download("trace.json", "application/json", string_view(buffer));
+    }
+#endif
+    tooltip("Save the recorded frames in the Chrome trace format, which chrome://tracing and ui.perfetto.dev can "
+            "open.");
+
+    auto frames = profiler.frames();
+    if (frames.empty())
+    {
+        ImGui::TextUnformatted("No frames recorded yet.");
+        return;
+    }
+
+    //
+    // Frame times; clicking one shows it in the timeline below
+    //
+    vector<float> frame_ms(frames.size());
+    int           selected = (int)frames.size() - 1;
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        frame_ms[i] = (frames[i].end - frames[i].start) * 1e-6f;
+        if (frames[i].index == m_profiler_frame)
+            selected = (int)i;
+    }
+    float max_ms = *std::max_element(frame_ms.begin(), frame_ms.end());
+
+    ImGui::PlotHistogram("##frame times", frame_ms.data(), (int)frame_ms.size(), 0, nullptr, 0.f, max_ms,
+                         float2{-FLT_MIN, 3.f * ImGui::GetFontSize()});
+    if (ImGui::IsItemHovered() && ImGui::IsMouseClicked(0))
+    {
+        float t = (ImGui::GetMousePos().x - ImGui::GetItemRectMin().x) / ImGui::GetItemRectSize().x;
+        m_profiler_frame = frames[std::clamp(int(t * frames.size()), 0, (int)frames.size() - 1)].index;
+    }
+    tooltip("Time taken by each of the recent frames. Click one to inspect it below.");
+
+    const auto &frame = frames[selected];
+    ImGui::Text("Frame %llu: %.3f ms", (unsigned long long)frame.index, frame_ms[selected]);
+    if (m_profiler_frame)
+    {
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Follow the latest frame"))
+            m_profiler_frame = 0;
+    }
+
+    //
+    // Timeline of the selected frame, with one row per thread and nesting depth
+    //
+    std::map<int, int> thread_depths; // the deepest zone on each thread
+    for (auto &zone : frame.zones) thread_depths[zone.thread] = std::max(thread_depths[zone.thread], zone.depth);
+    std::map<int, int> thread_rows; // the first row of each thread
+    int                num_rows = 0;
+    for (auto &[thread, depth] : thread_depths)
+    {
+        thread_rows[thread] = num_rows;
+        num_rows += depth + 1;
+    }
+
+    float  row_height = ImGui::GetTextLineHeightWithSpacing();
+    float2 origin     = ImGui::GetCursorScreenPos();
+    float  width      = ImGui::GetContentRegionAvail().x;
+    double duration   = std::max<double>(double(frame.end - frame.start), 1.0);
+    auto   draw_list  = ImGui::GetWindowDrawList();
+    for (auto &zone : frame.zones)
+    {
+        // zones on other threads may have started in an earlier frame
+        float  x0 = origin.x + width * float(std::max<double>(double(zone.start - frame.start), 0.0) / duration);
+        float  x1 = origin.x + width * float(std::min<double>(double(zone.end - frame.start), duration) / duration);
+        float  y0 = origin.y + row_height * (thread_rows[zone.thread] + zone.depth);
+        float2 p0{x0, y0}, p1{std::max(x1, x0 + 1.f), y0 + row_height - 1.f};
+
+        float hue = float(std::hash<string>()(zone.name) % 360) / 360.f;
+        draw_list->AddRectFilled(p0, p1, ImColor::HSV(hue, 0.5f, 0.7f));
+
+        float ms    = (zone.end - zone.start) * 1e-6f;
+        auto  label = fmt::format("{} {:.3f} ms", zone.name, ms);
+        if (ImGui::CalcTextSize(label.c_str()).x < p1.x - p0.x - 4.f)
+            draw_list->AddText(float2{p0.x + 2.f, p0.y}, IM_COL32_WHITE, label.c_str());
+
+        if (ImGui::IsMouseHoveringRect(p0, p1))
+            ImGui::SetTooltip("%s\n%.3f ms on thread %d", zone.name, ms, zone.thread);
+    }
+    ImGui::Dummy(float2{width, row_height * std::max(num_rows, 1)});
+
+    //
+    // Totals of each zone in the selected frame, and averaged over all recent frames
+    //
+    std::map<string, float2> totals; // milliseconds in the selected frame, and in all frames
+    for (auto &f : frames)
+        for (auto &zone : f.zones)
+        {
+            float ms = (zone.end - zone.start) * 1e-6f;
+            totals[zone.name].y += ms;
+            if (&f == &frame)
+                totals[zone.name].x += ms;
+        }
+
+    if (ImGui::BeginTable("zones", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV))
+    {
+        ImGui::TableSetupColumn("Zone");
+        ImGui::TableSetupColumn("This frame (ms)");
+        ImGui::TableSetupColumn("Average (ms)");
+        ImGui::TableHeadersRow();
+        for (auto &[name, ms] : totals)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", ms.x);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", ms.y / frames.size());
+        }
+        ImGui::EndTable();
+    }
+}
+
 bool SampleViewer::process_event(void *e)
 {
 #ifdef HELLOIMGUI_USE_SDL2
@@ -1055,14 +1452,14 @@ void SampleViewer::process_hotkeys()
         if ((unsigned)strength != oa->strength())
         {
             oa->setStrength(strength);
-            m_gpu_points_dirty = m_cpu_points_dirty = true;
+            invalidate_points();
         }
     };
     auto change_offset_type = [oa, this](int offset)
     {
         oa->setOffsetType(offset);
-        m_jitter           = oa->jitter();
-        m_gpu_points_dirty = m_cpu_points_dirty = true;
+        m_jitter = oa->jitter();
+        invalidate_points();
     };
 
     if ((ImGui::IsKeyPressed(ImGuiKey_UpArrow) || ImGui::IsKeyPressed(ImGuiKey_DownArrow)) &&
@@ -1140,6 +1537,15 @@ void SampleViewer::process_hotkeys()
 
 void SampleViewer::update_points(bool regenerate)
 {
+    ProfileZone zone("update points");
+
+    // streamed CSV files only read the points in the displayed index range, so changing that range means reading
+    // a different set of points
+    CSVFile *csv       = dynamic_cast<CSVFile *>(m_samplers[m_sampler]);
+    bool     streaming = csv && csv->streaming();
+    if (streaming && m_subset_by_index)
+        regenerate = true;
+
     //
     // Generate the point positions
     //
@@ -1147,88 +1553,458 @@ void SampleViewer::update_points(bool regenerate)
     {
         try
         {
-            Timer    timer;
-            Sampler *generator = m_samplers[m_sampler];
-            if (generator->seed() != m_seed)
-                generator->setSeed(m_seed);
-
-            generator->setDimensions(m_num_dimensions);
-
-            int num_pts   = generator->setNumSamples(m_target_point_count);
-            m_point_count = num_pts >= 0 ? num_pts : m_target_point_count;
+            ProfileZone generate_zone("generate");
+            Timer       timer;
+            Sampler    *generator = m_samplers[m_sampler];
+            int         num_pts;
+            if (csv)
+            {
+                ProfileZone setup_zone("set up sampler");
+                if (generator->seed() != m_seed)
+                    generator->setSeed(m_seed);
 
-            m_time1 = timer.elapsed();
+                generator->setDimensions(m_num_dimensions);
 
-            m_points.resize(m_num_dimensions, m_point_count);
-            m_points.reset(0.5f);
-            m_3d_points.resize(m_point_count);
+                num_pts = generator->setNumSamples(m_target_point_count);
+                m_time1 = timer.elapsed();
+            }
+            else
+            {
+                // setting up other samplers can be slow, so that is left to the background task; most can tell how
+                // many points that makes right away, and the task reports it for the others
+                num_pts = generator->roundNumSamples(m_target_point_count);
+                if (num_pts == 0)
+                    num_pts = m_target_point_count;
+            }
+            m_requested_key = {m_sampler, num_pts >= 0 ? num_pts : m_target_point_count, m_num_dimensions, m_seed,
+                               m_jitter};
+            if (auto oa = dynamic_cast<OrthogonalArray *>(generator))
+            {
+                m_requested_key.strength    = oa->strength();
+                m_requested_key.offset_type = oa->offsetType();
+            }
 
-            timer.reset();
-            for (int i = 0; i < m_point_count; ++i) generator->sample(m_points.row(i), i);
-            m_time2 = timer.elapsed();
+            // CSV files are read right here, since their state can't be handed to a background task; everything else
+            // is generated by request_points() below.
+            // The cached columns are still valid if e.g. the requested number of points rounds to the same count.
+            if (csv && (m_requested_key != m_columns_key || streaming))
+            {
+                cancel_points_task();
+                m_point_count = m_requested_key.num_points;
+                m_columns.assign(m_num_dimensions, {});
+                m_generated_dims      = 0;
+                m_columns_key         = {};
+                m_first_changed_point = 0;
+                ++m_columns_version;
+
+                // streamed CSV files read every dimension anyway
+                DimensionMask dims = streaming ? ALL_DIMENSIONS : displayed_dimensions(m_num_dimensions);
+
+                timer.reset();
+                int first = 0, count = m_point_count;
+                if (streaming && m_subset_by_index)
+                {
+                    first = std::clamp(m_first_draw_point, 0, m_point_count - 1);
+                    count = std::clamp(m_point_draw_count, 0, m_point_count - first);
+                    csv->prefetch(first, count);
+                }
+                {
+                    ProfileZone sample_zone("sample");
+                    m_perf_counters.start();
+                    generate_columns(dims, first, count);
+                    m_perf_summary = m_perf_counters.stop().per_point_summary(count);
+                }
+                m_time2           = timer.elapsed();
+                m_columns_key     = m_requested_key;
+                m_coarse_grid_res = csv->coarseGridRes(m_point_count);
+                m_columns_sampler.reset();
+            }
         }
         catch (const std::exception &e)
         {
             fmt::print(stderr, "An error occurred while generating points: {}.", e.what());
             HelloImGui::Log(HelloImGui::LogLevel::Error, "An error occurred while generating points: %s.", e.what());
+            m_columns_key = {};
             return;
         }
         m_cpu_points_dirty = false;
     }
+    else if (csv && m_first_new_point >= 0)
+    {
+        // only read the points that were added to the end
+        ProfileZone zone("sample new points");
+        int         first = m_first_new_point;
+        m_point_count     = std::max(csv->numSamples(), 0);
+        if (first > m_point_count || m_columns_key.num_points < first)
+            first = 0;
+
+        m_requested_key.num_points = m_point_count;
+        ++m_columns_version;
+        resize_columns(first);
+        m_coarse_grid_res = csv->coarseGridRes(m_point_count);
+    }
+    m_first_new_point = -1;
+
+    // e.g. the XYZ mapping changed to dimensions that were skipped so far
+    try
+    {
+        if (csv)
+            generate_missing_dimensions(displayed_dimensions(m_num_dimensions));
+        else
+            request_points();
+    }
+    catch (const std::exception &e)
+    {
+        fmt::print(stderr, "An error occurred while generating points: {}.", e.what());
+        HelloImGui::Log(HelloImGui::LogLevel::Error, "An error occurred while generating points: %s.", e.what());
+        return;
+    }
+
+    // keep showing the last completed points until the ones being generated have all the displayed dimensions
+    int           num_dims = (int)m_columns.size();
+    DimensionMask all_dims = num_dims < 64 ? (DimensionMask(1) << num_dims) - 1 : ALL_DIMENSIONS;
+    if (num_dims == 0 || (displayed_dimensions(num_dims) & all_dims & ~m_generated_dims))
+    {
+        m_gpu_points_dirty = false;
+        return;
+    }
 
     //
-    // Populate point subsets
+    // Select the point subset, unless only e.g. the XYZ mapping changed
     //
-    m_subset_points = m_points;
-    m_subset_count  = m_point_count;
-    if (m_subset_by_coord)
+    auto subset_source = std::make_tuple(m_columns_version, m_point_count, m_subset_by_coord, m_subset_axis,
+                                         m_num_subset_levels, m_subset_level);
+    if (subset_source != m_subset_source)
     {
-        m_subset_count = 0;
-        for (int i = 0; i < m_points.sizeY(); ++i)
+        ProfileZone subset_zone("subset");
+        m_subset_indices.clear();
+        m_subset_count = m_point_count;
+        if (m_subset_by_coord)
         {
-            float v = m_points(std::clamp(m_subset_axis, 0, m_num_dimensions - 1), i);
-            if (v >= (m_subset_level + 0.0f) / m_num_subset_levels && v < (m_subset_level + 1.0f) / m_num_subset_levels)
+            const float *v = m_columns[std::clamp(m_subset_axis, 0, num_dims - 1)].data();
+            for (int i = 0; i < m_point_count; ++i)
+                if (v[i] >= (m_subset_level + 0.0f) / m_num_subset_levels &&
+                    v[i] < (m_subset_level + 1.0f) / m_num_subset_levels)
+                    m_subset_indices.push_back(i);
+            m_subset_count = (int)m_subset_indices.size();
+        }
+        m_subset_source      = subset_source;
+        m_2d_points_outdated = true;
+    }
+
+    // the points that didn't change keep their place in the 3D buffer, unless the XYZ mapping or the subset changed
+    int first_3d_point;
+    {
+        ProfileZone  build_zone("build 3D buffer");
+        int3         dims   = linalg::clamp(m_dimension, int3{0}, int3{num_dims - 1});
+        auto         source = std::make_tuple(dims.x, dims.y, dims.z, m_subset_by_coord);
+        const float *x = m_columns[dims.x].data(), *y = m_columns[dims.y].data(), *z = m_columns[dims.z].data();
+        first_3d_point = m_subset_by_coord || source != m_3d_points_source
+                             ? 0
+                             : std::min(m_first_changed_point, (int)m_3d_points.size());
+        m_3d_points.resize(m_subset_count);
+        if (m_subset_by_coord)
+            for (int i = first_3d_point; i < m_subset_count; ++i)
             {
-                // copy all dimensions (rows) of point i
-                for (int dim = 0; dim < m_points.sizeX(); ++dim)
-                    m_subset_points(dim, m_subset_count) = m_points(dim, i);
-                ++m_subset_count;
+                int p          = m_subset_indices[i];
+                m_3d_points[i] = float3{x[p], y[p], z[p]};
             }
-        }
+        else
+            for (int i = first_3d_point; i < m_subset_count; ++i) m_3d_points[i] = float3{x[i], y[i], z[i]};
+        m_3d_points_source    = source;
+        m_first_changed_point = m_point_count;
     }
 
-    int3 dims = linalg::clamp(m_dimension, int3{0}, int3{m_num_dimensions - 1});
-    for (size_t i = 0; i < m_3d_points.size(); ++i)
-        m_3d_points[i] = float3{m_subset_points(dims.x, i), m_subset_points(dims.y, i), m_subset_points(dims.z, i)};
+    //
+    // create a temporary array to store all the 2D projections of the points.
+    // each 2D plot actually needs 3D points, and there are num2DPlots of them
+    // (only the 2D view shows them; set_view() updates the points when switching to it)
+    bool upload_2d = m_view == CAMERA_2D && m_2d_points_outdated;
+    if (upload_2d)
+    {
+        ProfileZone build_zone("build 2D buffer");
+        int         num2DPlots = num_dims * (num_dims - 1) / 2;
+        m_2d_points.resize(num2DPlots * m_subset_count);
+        for (int y = 0, plot_index = 0; y < num_dims; ++y)
+            for (int x = 0; x < y; ++x, ++plot_index)
+            {
+                const float *cx = m_columns[x].data(), *cy = m_columns[y].data();
+                float3      *out = &m_2d_points[size_t(plot_index) * m_subset_count];
+                for (int i = 0; i < m_subset_count; ++i)
+                {
+                    int p  = m_subset_by_coord ? m_subset_indices[i] : i;
+                    out[i] = float3{cx[p], cy[p], -0.5f};
+                }
+            }
+        m_2d_dimensions      = num_dims;
+        m_2d_count           = m_subset_count;
+        m_2d_points_outdated = false;
+    }
 
     //
     // Upload points to the GPU
     //
+    {
+        ProfileZone upload_zone("upload to GPU");
+        m_3d_point_shader->update_buffer("center", m_3d_points, first_3d_point);
+        m_3d_point_shader->set_buffer_divisor("center", 1); // one center per quad/instance
 
-    auto range = get_draw_range();
-    m_3d_point_shader->set_buffer("center", m_3d_points, range.x, range.y);
-    m_3d_point_shader->set_buffer_divisor("center", 1); // one center per quad/instance
-
-    //
-    // create a temporary array to store all the 2D projections of the points.
-    // each 2D plot actually needs 3D points, and there are num2DPlots of them
-    int num2DPlots = m_num_dimensions * (m_num_dimensions - 1) / 2;
-    m_2d_points.resize(num2DPlots * m_subset_count);
-    for (int y = 0, plot_index = 0; y < m_num_dimensions; ++y)
-        for (int x = 0; x < y; ++x, ++plot_index)
-            for (int i = 0; i < m_subset_count; ++i)
-                m_2d_points[plot_index * m_subset_count + i] =
-                    float3{m_subset_points(x, i), m_subset_points(y, i), -0.5f};
-
-    m_2d_point_shader->set_buffer("center", m_2d_points);
-    m_2d_point_shader->set_buffer_divisor("center", 1); // one center per quad/instance
+        if (upload_2d)
+        {
+            m_2d_point_shader->set_buffer("center", m_2d_points);
+            m_2d_point_shader->set_buffer_divisor("center", 1); // one center per quad/instance
+        }
+    }
 
     m_gpu_points_dirty = false;
 }
 
+/// Mark the points as outdated because their source changed in a way the cached columns can't tell from their key,
+/// e.g. a different CSV file
+void SampleViewer::invalidate_points()
+{
+    // the points being generated are outdated too
+    cancel_points_task();
+    m_columns_key      = {};
+    m_gpu_points_dirty = m_cpu_points_dirty = true;
+}
+
+/**
+    Bring the cached columns up to date with m_requested_key and the displayed dimensions.
+
+    Dropping points from the end of an infinite sequence happens right away. Anything that needs generating happens in
+    a PointTask on a background thread, while the last completed points keep being shown; adopt_points() swaps in its
+    points once it's done. The first points of an infinite sequence don't depend on how many there are, so growing
+    one only generates the new points at the end.
+*/
+void SampleViewer::request_points(DimensionMask extra_dims)
+{
+    const PointSetKey &key = m_requested_key;
+    if (m_point_task)
+    {
+        // a task that's working towards the same points gets to finish; anything it misses is requested after that
+        if (m_point_task->key == key)
+            return;
+        cancel_points_task();
+    }
+
+    bool extensible = m_samplers[m_sampler]->numSamples() < 0 && key.same_sequence(m_columns_key);
+    if (extensible && key.num_points < m_columns_key.num_points)
+    {
+        m_point_count = key.num_points;
+        resize_columns(m_point_count);
+        if (m_columns_sampler)
+        {
+            reclaim_columns_sampler();
+            m_coarse_grid_res = m_columns_sampler->coarseGridRes(m_point_count);
+        }
+    }
+
+    int           first = 0;
+    DimensionMask all   = key.num_dimensions < 64 ? (DimensionMask(1) << key.num_dimensions) - 1 : ALL_DIMENSIONS;
+    DimensionMask dims  = (displayed_dimensions(key.num_dimensions) | extra_dims) & all;
+    if (key == m_columns_key)
+    {
+        dims &= ~m_generated_dims;
+        if (!dims)
+            return;
+    }
+    else if (extensible)
+    {
+        first = m_columns_key.num_points;
+        dims  = m_generated_dims & all;
+    }
+
+    // adding to the cached points continues with their sampler, once no abandoned task uses it anymore
+    std::shared_ptr<Sampler> sampler;
+    if (m_columns_sampler && (first > 0 || key == m_columns_key))
+    {
+        reclaim_columns_sampler();
+        sampler = m_columns_sampler;
+    }
+
+    // otherwise the task sets up its own instance of the sampler in the same way
+    BatchOptions options;
+    options.num_points     = m_target_point_count;
+    options.num_dimensions = std::clamp((unsigned)key.num_dimensions, m_samplers[m_sampler]->minDimensions(),
+                                        m_samplers[m_sampler]->maxDimensions());
+    options.seed           = key.seed;
+    options.jitter         = key.jitter;
+    options.strength       = key.strength;
+    if (key.offset_type >= 0)
+        options.offset_type = to_string(key.offset_type);
+    m_point_task = std::make_unique<PointTask>(key, options, sampler, dims, first);
+}
+
+/// Swap in the points of the background task once it has finished
+void SampleViewer::adopt_points()
+{
+    // abandoned tasks stop after their current block of points
+    m_abandoned_tasks.erase(std::remove_if(m_abandoned_tasks.begin(), m_abandoned_tasks.end(),
+                                           [](const std::unique_ptr<PointTask> &task) { return task->finished; }),
+                            m_abandoned_tasks.end());
+
+    if (!m_point_task || !m_point_task->finished)
+        return;
+
+    std::unique_ptr<PointTask> task = std::move(m_point_task);
+    if (!task->error.empty())
+    {
+        fmt::print(stderr, "An error occurred while generating points: {}.", task->error);
+        HelloImGui::Log(HelloImGui::LogLevel::Error, "An error occurred while generating points: %s.",
+                        task->error.c_str());
+        return;
+    }
+
+    if (task->first == 0 && task->key != m_columns_key)
+    {
+        // a whole new set of points
+        m_columns             = std::move(task->columns);
+        m_generated_dims      = task->dims;
+        m_first_changed_point = 0;
+        ++m_columns_version;
+        m_time1        = task->setup_time;
+        m_time2        = task->time;
+        m_perf_summary = task->perf_summary;
+    }
+    else if (task->first == 0)
+    {
+        // the dimensions that were missing so far
+        for (int d = 0; d < task->key.num_dimensions; ++d)
+            if (hasDimension(task->dims, d))
+                m_columns[d] = std::move(task->columns[d]);
+        m_generated_dims |= task->dims;
+    }
+    else if (task->key.same_sequence(m_columns_key) && task->first == m_columns_key.num_points)
+    {
+        // the new points at the end of an infinite sequence; any other columns would now be too short
+        for (int d = 0; d < task->key.num_dimensions; ++d)
+            if (hasDimension(task->dims, d))
+                m_columns[d].insert(m_columns[d].end(), task->columns[d].begin(), task->columns[d].end());
+            else
+                m_columns[d].clear();
+        m_generated_dims      = task->dims;
+        m_first_changed_point = std::min(m_first_changed_point, task->first);
+        m_time1               = task->setup_time;
+        m_time2               = task->time;
+        m_perf_summary        = task->perf_summary;
+    }
+    else
+        return; // the cached points changed in the meantime
+
+    // the UI draws with the cached grid resolution, since the sampler may be lent to the next task while it does
+    m_columns_key      = task->key;
+    m_columns_sampler  = task->sampler;
+    m_point_count      = task->num_points;
+    m_coarse_grid_res  = task->sampler->coarseGridRes(m_point_count);
+    m_gpu_points_dirty = true;
+}
+
+/// Wait until the points are up to date and have the dimensions `dims`, e.g. before exporting them
+void SampleViewer::finish_points(DimensionMask dims)
+{
+    if (dynamic_cast<CSVFile *>(m_samplers[m_sampler]))
+    {
+        generate_missing_dimensions(dims);
+        return;
+    }
+
+    auto finish = [this]
+    {
+        if (!m_point_task)
+            return;
+        m_point_task->wait();
+        adopt_points();
+    };
+    finish();
+    // the dimensions the points skipped so far
+    request_points(dims);
+    finish();
+}
+
+/// Stop the background task without waiting for it, and forget about its points
+void SampleViewer::cancel_points_task()
+{
+    if (!m_point_task)
+        return;
+    m_point_task->cancelled = true;
+    m_abandoned_tasks.push_back(std::move(m_point_task));
+}
+
+/// The dimensions of the points that are shown: the three of the 3D view and the one filtered by, or all of them in the
+/// 2D view of all pairs of dimensions, if the points have `num_dims` dimensions
+DimensionMask SampleViewer::displayed_dimensions(int num_dims) const
+{
+    if (m_view == CAMERA_2D)
+        return ALL_DIMENSIONS;
+
+    int3          dims = linalg::clamp(m_dimension, int3{0}, int3{num_dims - 1});
+    DimensionMask mask = (DimensionMask(1) << dims.x) | (DimensionMask(1) << dims.y) | (DimensionMask(1) << dims.z);
+    if (m_subset_by_coord)
+        mask |= DimensionMask(1) << std::clamp(m_subset_axis, 0, num_dims - 1);
+    return mask;
+}
+
+/// Wait for the abandoned tasks that still sample with m_columns_sampler, before using it on this thread
+void SampleViewer::reclaim_columns_sampler()
+{
+    for (auto &task : m_abandoned_tasks)
+        if (task->lent && task->sampler == m_columns_sampler)
+            task->wait();
+}
+
+/// Generate the coordinates of points [first, first + count) in the dimensions `dims` into their columns
+void SampleViewer::generate_columns(DimensionMask dims, int first, int count)
+{
+    m_columns.resize(m_num_dimensions);
+    for (int d = 0; d < m_num_dimensions; ++d)
+        if (hasDimension(dims, d) && m_columns[d].empty())
+            m_columns[d].assign(m_point_count, 0.5f);
+
+    sample_columns(m_samplers[m_sampler], m_num_dimensions, dims, first, count, m_columns, 0);
+    m_generated_dims |= dims;
+}
+
+/// Resize the generated columns to m_point_count points, and (re)generate the points from index `first` on
+void SampleViewer::resize_columns(int first)
+{
+    for (auto &column : m_columns)
+        if (!column.empty())
+            column.resize(m_point_count, 0.5f);
+    m_columns_key.num_points = m_point_count;
+    m_first_changed_point    = std::min(m_first_changed_point, first);
+    if (first < m_point_count)
+        generate_columns(m_generated_dims, first, m_point_count - first);
+}
+
+/// Generate the dimensions in `dims` that were skipped when the points were generated, right away
+void SampleViewer::generate_missing_dimensions(DimensionMask dims)
+{
+    DimensionMask missing = dims & ~m_generated_dims;
+    if (!missing)
+        return;
+
+    ProfileZone zone("sample missing dimensions");
+    generate_columns(missing, 0, m_point_count);
+}
+
+/// The displayed subset of the points as one row per point, e.g. to export them
+Array2d<float> SampleViewer::subset_points() const
+{
+    Array2d<float> points(m_num_dimensions, m_subset_count);
+    for (int d = 0; d < std::min(m_num_dimensions, (int)m_columns.size()); ++d)
+    {
+        if (m_columns[d].empty())
+            continue;
+        for (int i = 0; i < m_subset_count; ++i)
+            points(d, i) = m_columns[d][m_subset_by_coord ? m_subset_indices[i] : i];
+    }
+    return points;
+}
+
 void SampleViewer::draw_2D_points_and_grid(const float4x4 &mvp, int2 dims, int plot_index)
 {
-    float4x4 pos = layout_2d_matrix(m_num_dimensions, dims);
+    float4x4 pos = layout_2d_matrix(m_2d_dimensions, dims);
 
     // Render the point set
     m_2d_point_shader->set_uniform("mvp", mul(mvp, pos));
@@ -1238,9 +2014,9 @@ void SampleViewer::draw_2D_points_and_grid(const float4x4 &mvp, int2 dims, int p
     m_2d_point_shader->set_uniform("point_size", radius);
     m_2d_point_shader->set_uniform("color", m_point_color);
     int2 range = get_draw_range();
+    range.y    = std::min(range.y, m_2d_count - range.x); // the 2D buffer may still hold the last completed points
 
-    m_2d_point_shader->set_buffer_pointer_offset("center",
-                                                 size_t(m_subset_count * plot_index + range.x) * sizeof(float3));
+    m_2d_point_shader->set_buffer_pointer_offset("center", size_t(m_2d_count * plot_index + range.x) * sizeof(float3));
     m_2d_point_shader->set_buffer_divisor("center", 1); // one center per quad/instance
 
     if (range.y > 0)
@@ -1256,7 +2032,7 @@ void SampleViewer::draw_2D_points_and_grid(const float4x4 &mvp, int2 dims, int p
         draw_grid(mat, int2{1}, 1.f);
 
     if (m_show_coarse_grid)
-        draw_grid(mat, int2{m_samplers[m_sampler]->coarseGridRes(m_point_count)}, 0.6f);
+        draw_grid(mat, int2{m_coarse_grid_res}, 0.6f);
 
     if (m_show_fine_grid)
         draw_grid(mat, int2{m_point_count}, 0.2f);
@@ -1273,7 +2049,25 @@ void SampleViewer::draw_background()
 
     try
     {
-        // update the points and grids if outdated
+        if (auto csv = dynamic_cast<CSVFile *>(m_samplers[m_sampler]))
+        {
+            // follow CSV files that are still being written
+            if (int first = csv->update(); first >= 0)
+            {
+                m_first_new_point  = first;
+                m_gpu_points_dirty = true;
+            }
+
+            // advance to the next frame of a CSV sequence
+            if (m_play_frames && csv->numFrames() > 1)
+            {
+                csv->setFrame((csv->frame() + 1) % csv->numFrames());
+                invalidate_points();
+            }
+        }
+
+        // swap in the points generated in the background, and update the points and grids if outdated
+        adopt_points();
         if (m_gpu_points_dirty || m_cpu_points_dirty)
             update_points(m_cpu_points_dirty);
 
@@ -1351,7 +2145,7 @@ void SampleViewer::draw_background()
             if (t >= 1.0f)
             {
                 camera.camera_type         = camera1.camera_type;
-                m_params.fpsIdling.fpsIdle = 9.f; // animation is done, reduce FPS
+                m_params.fpsIdling.fpsIdle = m_play_frames ? 0.f : 9.f; // animation is done, reduce FPS
                 m_animate_start_time       = 0.f;
             }
 
@@ -1368,6 +2162,8 @@ void SampleViewer::draw_background()
         // clear the framebuffer and set up the viewport
         //
 
+        // draw calls only queue up work for the GPU, so these zones measure their CPU-side cost
+        ProfileZone draw_zone("draw");
         m_render_pass.resize(fbsize);
         m_render_pass.set_viewport(viewport_offset * fbscale, viewport_size * fbscale);
         m_render_pass.set_clear_color(float4{m_bg_color, 1.f});
@@ -1383,14 +2179,18 @@ void SampleViewer::draw_background()
         //
         if (m_view == CAMERA_2D)
         {
-            int plot_index = 0;
-            for (int y = 0; y < m_num_dimensions; ++y)
-                for (int x = 0; x < y; ++x, ++plot_index) draw_2D_points_and_grid(mvp, int2{x, y}, plot_index);
+            {
+                ProfileZone points_zone("2D plots");
+                int         plot_index = 0;
+                for (int y = 0; y < m_2d_dimensions; ++y)
+                    for (int x = 0; x < y; ++x, ++plot_index) draw_2D_points_and_grid(mvp, int2{x, y}, plot_index);
+            }
 
             // draw the text labels for the grid of 2D projections
-            for (int i = 0; i < m_num_dimensions - 1; ++i)
+            ProfileZone labels_zone("labels");
+            for (int i = 0; i < m_2d_dimensions - 1; ++i)
             {
-                float4x4 pos      = layout_2d_matrix(m_num_dimensions, int2{i, m_num_dimensions - 1});
+                float4x4 pos      = layout_2d_matrix(m_2d_dimensions, int2{i, m_2d_dimensions - 1});
                 float4   text_pos = mul(mvp, mul(pos, float4{0.f, -0.5f, -1.0f, 1.0f}));
                 float2   text_2d_pos((text_pos.x / text_pos.w + 1) / 2, (text_pos.y / text_pos.w + 1) / 2);
                 draw_text(viewport_offset + int2(int((text_2d_pos.x) * viewport_size.x),
@@ -1398,7 +2198,7 @@ void SampleViewer::draw_background()
                           to_string(i), float4(1.0f, 1.0f, 1.0f, 0.75f), m_regular, 16,
                           TextAlign_CENTER | TextAlign_BOTTOM);
 
-                pos         = layout_2d_matrix(m_num_dimensions, int2{0, i + 1});
+                pos         = layout_2d_matrix(m_2d_dimensions, int2{0, i + 1});
                 text_pos    = mul(mvp, mul(pos, float4{-0.5f, 0.f, -1.0f, 1.0f}));
                 text_2d_pos = float2((text_pos.x / text_pos.w + 1) / 2, (text_pos.y / text_pos.w + 1) / 2);
                 draw_text(viewport_offset + int2(int((text_2d_pos.x) * viewport_size.x) - 4,
@@ -1409,48 +2209,55 @@ void SampleViewer::draw_background()
         }
         else
         {
-            if (m_show_1d_projections)
             {
-                // smash the points against the axes and draw
-                float4x4 smashX =
-                    mul(translation_matrix(float3{-0.51f, 0.f, 0.f}), scaling_matrix(float3{0.f, 1.f, 1.f}));
-                draw_points(mvp, smashX, {0.8f, 0.3f, 0.3f});
-
-                float4x4 smashY =
-                    mul(translation_matrix(float3{0.f, -0.51f, 0.f}), scaling_matrix(float3{1.f, 0.f, 1.f}));
-                draw_points(mvp, smashY, {0.3f, 0.8f, 0.3f});
-
-                float4x4 smashZ =
-                    mul(translation_matrix(float3{0.f, 0.f, -0.51f}), scaling_matrix(float3{1.f, 1.f, 0.f}));
-                draw_points(mvp, smashZ, {0.3f, 0.3f, 0.8f});
-            }
+                ProfileZone points_zone("3D points");
+                if (m_show_1d_projections)
+                {
+                    // smash the points against the axes and draw
+                    float4x4 smashX =
+                        mul(translation_matrix(float3{-0.51f, 0.f, 0.f}), scaling_matrix(float3{0.f, 1.f, 1.f}));
+                    draw_points(mvp, smashX, {0.8f, 0.3f, 0.3f});
+
+                    float4x4 smashY =
+                        mul(translation_matrix(float3{0.f, -0.51f, 0.f}), scaling_matrix(float3{1.f, 0.f, 1.f}));
+                    draw_points(mvp, smashY, {0.3f, 0.8f, 0.3f});
+
+                    float4x4 smashZ =
+                        mul(translation_matrix(float3{0.f, 0.f, -0.51f}), scaling_matrix(float3{1.f, 1.f, 0.f}));
+                    draw_points(mvp, smashZ, {0.3f, 0.3f, 0.8f});
+                }
 
-            draw_points(mvp, float4x4(linalg::identity), m_point_color);
+                draw_points(mvp, float4x4(linalg::identity), m_point_color);
+            }
 
-            if (m_show_custom_grid)
             {
-                // compute the three dimension pairs we use for the XY, XZ, and ZY axes
-                int3   dims = linalg::clamp(m_dimension, int3{0}, int3{m_num_dimensions - 1});
-                int2x3 counts{{m_custom_line_counts[dims.x], m_custom_line_counts[dims.y]},
-                              {m_custom_line_counts[dims.x], m_custom_line_counts[dims.z]},
-                              {m_custom_line_counts[dims.z], m_custom_line_counts[dims.y]}};
-                draw_trigrid(m_grid_shader, mvp, 1.f, counts);
-            }
+                ProfileZone grids_zone("grids");
+                if (m_show_custom_grid)
+                {
+                    // compute the three dimension pairs we use for the XY, XZ, and ZY axes
+                    int3   dims = linalg::clamp(m_dimension, int3{0}, int3{m_num_dimensions - 1});
+                    int2x3 counts{{m_custom_line_counts[dims.x], m_custom_line_counts[dims.y]},
+                                  {m_custom_line_counts[dims.x], m_custom_line_counts[dims.z]},
+                                  {m_custom_line_counts[dims.z], m_custom_line_counts[dims.y]}};
+                    draw_trigrid(m_grid_shader, mvp, 1.f, counts);
+                }
 
-            if (m_show_bbox)
-                draw_trigrid(m_grid_shader, mvp, 1.0f, int2x3{1});
+                if (m_show_bbox)
+                    draw_trigrid(m_grid_shader, mvp, 1.0f, int2x3{1});
 
-            if (m_show_coarse_grid)
-                draw_trigrid(m_grid_shader, mvp, 0.6f, int2x3{m_samplers[m_sampler]->coarseGridRes(m_point_count)});
+                if (m_show_coarse_grid)
+                    draw_trigrid(m_grid_shader, mvp, 0.6f, int2x3{m_coarse_grid_res});
 
-            if (m_show_fine_grid)
-                draw_trigrid(m_grid_shader, mvp, 0.2f, int2x3{m_point_count});
+                if (m_show_fine_grid)
+                    draw_trigrid(m_grid_shader, mvp, 0.2f, int2x3{m_point_count});
+            }
 
             //
             // draw the index or coordinate labels around each point
             //
-            int2  range  = get_draw_range();
-            float radius = m_radius / (m_scale_radius_with_points ? std::sqrt(m_point_count) : 1.0f);
+            ProfileZone labels_zone("labels");
+            int2        range  = get_draw_range();
+            float       radius = m_radius / (m_scale_radius_with_points ? std::sqrt(m_point_count) : 1.0f);
 
             if (m_show_point_nums || m_show_point_coords)
                 for (int p = range.x; p < range.x + range.y; ++p)
@@ -1491,6 +2298,10 @@ void SampleViewer::set_view(CameraType view)
         m_camera[CAMERA_CURRENT].camera_type = (view == m_camera[CAMERA_CURRENT].camera_type) ? view : CAMERA_CURRENT;
         m_view                               = view;
 
+        // the 2D view shows all dimensions, which may not have been generated yet
+        if (view == CAMERA_2D)
+            m_gpu_points_dirty = true;
+
         m_params.fpsIdling.fpsIdle = 0.f; // during animation, increase FPS
     }
 }
@@ -1508,6 +2319,7 @@ void SampleViewer::draw_points(const float4x4 &mvp, const float4x4 &smash, const
     float radius = m_radius / (m_scale_radius_with_points ? std::sqrt(m_point_count) : 1.0f);
     m_3d_point_shader->set_uniform("point_size", radius);
     m_3d_point_shader->set_uniform("color", color);
+    m_3d_point_shader->set_buffer_pointer_offset("center", size_t(range.x) * sizeof(float3));
 
     m_3d_point_shader->begin();
     m_3d_point_shader->draw_array(Shader::PrimitiveType::TriangleFan, 0, 4, false, range.y);
@@ -1580,91 +2392,203 @@ void SampleViewer::draw_text(const int2 &pos, const string &text, const float4 &
     ImGui::PopFont();
 }
 
-string SampleViewer::export_XYZ_points(const string &format)
+ExportParams SampleViewer::export_params() const
 {
-    float radius = m_radius / (m_scale_radius_with_points ? std::sqrt(m_point_count) : 1.0f);
+    ExportParams params;
+    params.points          = subset_points();
+    params.range           = get_draw_range();
+    params.num_dimensions  = m_num_dimensions;
+    params.dimension       = linalg::clamp(m_dimension, int3{0}, int3{m_num_dimensions - 1});
+    params.point_count     = m_point_count;
+    params.coarse_grid_res = m_coarse_grid_res;
+    params.radius          = m_radius / (m_scale_radius_with_points ? std::sqrt(m_point_count) : 1.0f);
+    params.point_color     = m_point_color;
+    params.fine_grid       = m_show_fine_grid;
+    params.coarse_grid     = m_show_coarse_grid;
+    params.bbox            = m_show_bbox;
+    params.compact_svg     = m_compact_svg;
+    params.png_size        = m_png_size;
+    params.png_density     = m_png_density;
+    std::copy(m_camera, m_camera + NUM_CAMERA_TYPES, params.camera);
+    params.sampler = m_samplers[m_sampler]->name();
+    params.seed    = m_seed;
+    return params;
+}
 
-    string out = (format == "eps") ? header_eps(m_point_color, radius) : header_svg(m_point_color);
+static void draw_grids(Raster &raster, const ExportParams &p, const float4x4 &mvp)
+{
+    draw_grids_png(raster, mvp, p.point_count, p.coarse_grid_res, p.fine_grid, p.coarse_grid, p.bbox);
+}
 
-    float4x4 mvp = m_camera[CAMERA_CURRENT].matrix(1.0f);
+static void draw_grids(FileWriter &out, const string &format, const ExportParams &p, const float4x4 &mvp)
+{
+    if (format == "eps")
+        draw_grids_eps(out, mvp, p.point_count, p.coarse_grid_res, p.fine_grid, p.coarse_grid, p.bbox);
+    else
+        draw_grids_svg(out, mvp, p.point_count, p.coarse_grid_res, p.fine_grid, p.coarse_grid, p.bbox);
+}
 
-    for (int axis = CAMERA_XY; axis < CAMERA_CURRENT; ++axis)
+static void export_XYZ_points(FileWriter &out, const string &format, const ExportParams &p)
+{
+    if (format == "png")
     {
-        if (format == "eps")
-            out += draw_grids_eps(mul(mvp, m_camera[axis].arcball.inv_matrix()), m_point_count,
-                                  m_samplers[m_sampler]->coarseGridRes(m_point_count), m_show_fine_grid,
-                                  m_show_coarse_grid, m_show_bbox);
-        else
-            out += draw_grids_svg(mul(mvp, m_camera[axis].arcball.inv_matrix()), m_point_count,
-                                  m_samplers[m_sampler]->coarseGridRes(m_point_count), m_show_fine_grid,
-                                  m_show_coarse_grid, m_show_bbox);
+        float4x4 mvp = p.camera[CAMERA_CURRENT].matrix(1.0f);
+        Raster   raster(p.png_size);
+        for (int axis = CAMERA_XY; axis < CAMERA_CURRENT; ++axis)
+            draw_grids(raster, p, mul(mvp, p.camera[axis].arcball.inv_matrix()));
+        draw_points_png(raster, mvp, p.dimension, p.points, p.range, p.radius, p.point_color, p.png_density);
+        write_png(out, raster);
+        return;
     }
 
-    int3 dims = linalg::clamp(m_dimension, int3{0}, int3{m_num_dimensions - 1});
-    out += (format == "eps") ? draw_points_eps(mvp, dims, m_subset_points, get_draw_range())
-                             : draw_points_svg(mvp, dims, m_subset_points, get_draw_range(), radius);
-
-    out += (format == "eps") ? footer_eps() : footer_svg();
-    return out;
-}
-
-string SampleViewer::export_points_2d(const string &format, CameraType camera_type, int3 dim)
-{
-    float radius = m_radius / (m_scale_radius_with_points ? std::sqrt(m_point_count) : 1.0f);
+    if (format == "eps")
+        header_eps(out, p.point_color, p.radius);
+    else
+        header_svg(out, p.point_color);
 
-    string out = (format == "eps") ? header_eps(m_point_color, radius) : header_svg(m_point_color);
+    float4x4 mvp = p.camera[CAMERA_CURRENT].matrix(1.0f);
 
-    float4x4 mvp = m_camera[camera_type].matrix(1.0f);
+    for (int axis = CAMERA_XY; axis < CAMERA_CURRENT; ++axis)
+        draw_grids(out, format, p, mul(mvp, p.camera[axis].arcball.inv_matrix()));
 
     if (format == "eps")
     {
-        out += draw_grids_eps(mvp, m_point_count, m_samplers[m_sampler]->coarseGridRes(m_point_count), m_show_fine_grid,
-                              m_show_coarse_grid, m_show_bbox);
-        out += draw_points_eps(mvp, dim, m_subset_points, get_draw_range());
+        draw_points_eps(out, mvp, p.dimension, p.points, p.range);
+        footer_eps(out);
     }
     else
     {
-        out += draw_grids_svg(mvp, m_point_count, m_samplers[m_sampler]->coarseGridRes(m_point_count), m_show_fine_grid,
-                              m_show_coarse_grid, m_show_bbox);
-        out += draw_points_svg(mvp, dim, m_subset_points, get_draw_range(), radius);
+        draw_points_svg(out, mvp, p.dimension, p.points, p.range, p.radius, p.compact_svg);
+        footer_svg(out);
     }
+}
+
+/// Export the 2D projection onto dimensions `dim`, reusing the vector grid fragment `grids` shared by all such
+/// projections
+static void export_points_2d(FileWriter &out, const string &format, const ExportParams &p, int3 dim,
+                             const string &grids)
+{
+    float4x4 mvp = p.camera[CAMERA_XY].matrix(1.0f);
 
-    out += (format == "eps") ? footer_eps() : footer_svg();
-    return out;
+    if (format == "png")
+    {
+        Raster raster(p.png_size);
+        draw_grids(raster, p, mvp);
+        draw_points_png(raster, mvp, dim, p.points, p.range, p.radius, p.point_color, p.png_density);
+        write_png(out, raster);
+    }
+    else if (format == "eps")
+    {
+        header_eps(out, p.point_color, p.radius);
+        out << grids;
+        draw_points_eps(out, mvp, dim, p.points, p.range);
+        footer_eps(out);
+    }
+    else
+    {
+        header_svg(out, p.point_color);
+        out << grids;
+        draw_points_svg(out, mvp, dim, p.points, p.range, p.radius, p.compact_svg);
+        footer_svg(out);
+    }
 }
 
-string SampleViewer::export_all_points_2d(const string &format)
+static void export_all_points_2d(FileWriter &out, const string &format, const ExportParams &p)
 {
-    float scale = 1.0f / (m_num_dimensions - 1);
+    float scale = 1.0f / (p.num_dimensions - 1);
 
-    float radius = m_radius / (m_scale_radius_with_points ? std::sqrt(m_point_count) : 1.0f);
+    if (format == "png")
+    {
+        float4x4 mvp = p.camera[CAMERA_2D].matrix(1.0f);
+        Raster   raster(p.png_size);
+        for (int y = 0; y < p.num_dimensions; ++y)
+            for (int x = 0; x < y; ++x)
+            {
+                float4x4 pos = mul(mvp, layout_2d_matrix(p.num_dimensions, int2{x, y}));
+                draw_grids(raster, p, pos);
+                draw_points_png(raster, pos, {x, y, 2}, p.points, p.range, p.radius * scale, p.point_color,
+                                p.png_density);
+            }
+        write_png(out, raster);
+        return;
+    }
 
-    string out = (format == "eps") ? header_eps(m_point_color, radius * scale) : header_svg(m_point_color);
+    if (format == "eps")
+        header_eps(out, p.point_color, p.radius * scale);
+    else
+        header_svg(out, p.point_color);
 
-    float4x4 mvp = m_camera[CAMERA_2D].matrix(1.0f);
+    float4x4 mvp = p.camera[CAMERA_2D].matrix(1.0f);
 
-    for (int y = 0; y < m_num_dimensions; ++y)
+    for (int y = 0; y < p.num_dimensions; ++y)
         for (int x = 0; x < y; ++x)
         {
-            float4x4 pos = layout_2d_matrix(m_num_dimensions, int2{x, y});
+            float4x4 pos = mul(mvp, layout_2d_matrix(p.num_dimensions, int2{x, y}));
 
+            draw_grids(out, format, p, pos);
             if (format == "eps")
-            {
-                out += draw_grids_eps(mul(mvp, pos), m_point_count, m_samplers[m_sampler]->coarseGridRes(m_point_count),
-                                      m_show_fine_grid, m_show_coarse_grid, m_show_bbox);
-                out += draw_points_eps(mul(mvp, pos), {x, y, 2}, m_subset_points, get_draw_range());
-            }
+                draw_points_eps(out, pos, {x, y, 2}, p.points, p.range);
             else
-            {
-                out += draw_grids_svg(mul(mvp, pos), m_point_count, m_samplers[m_sampler]->coarseGridRes(m_point_count),
-                                      m_show_fine_grid, m_show_coarse_grid, m_show_bbox);
-                out += draw_points_svg(mul(mvp, pos), {x, y, 2}, m_subset_points, get_draw_range(), radius * scale);
-            }
+                draw_points_svg(out, pos, {x, y, 2}, p.points, p.range, p.radius * scale, p.compact_svg);
+        }
+
+    if (format == "eps")
+        footer_eps(out);
+    else
+        footer_svg(out);
+}
+
+void SampleViewer::save_files(const string &basename, const string &ext)
+{
+    if (m_export)
+        throw std::runtime_error("Another export is still in progress");
+
+    ProfileZone zone("export snapshot");
+    finish_points(ALL_DIMENSIONS);
+
+    // the export runs in the background, so it works on a snapshot of the current state
+    auto                   params = std::make_shared<const ExportParams>(export_params());
+    vector<ExportTask::Job> jobs;
+    if (ext == "csv" || ext == "pts" || ext == "npy")
+    {
+        HelloImGui::Log(HelloImGui::LogLevel::Info, "Saving to: %s.", basename.c_str());
+        jobs.push_back({basename,
+                        [params, ext](FileWriter &out)
+                        {
+                            if (ext == "csv")
+                                draw_points_csv(out, params->points, params->range);
+                            else if (ext == "pts")
+                                draw_points_pts(out, params->points, params->range, params->sampler, params->seed);
+                            else
+                                draw_points_npy(out, params->points, params->range);
+                        }});
+    }
+    else
+    {
+        HelloImGui::Log(HelloImGui::LogLevel::Info, "Saving to base filename: %s.", basename.c_str());
+
+        // the largest files go first so that they don't end up determining the total time
+        jobs.push_back({basename + "_all2D." + ext,
+                        [params, ext](FileWriter &out) { export_all_points_2d(out, ext, *params); }});
+        jobs.push_back(
+            {basename + "_012." + ext, [params, ext](FileWriter &out) { export_XYZ_points(out, ext, *params); }});
+
+        // all 2D vector projections share the same grid
+        auto grids = std::make_shared<string>();
+        if (ext != "png")
+        {
+            FileWriter out(*grids);
+            draw_grids(out, ext, *params, params->camera[CAMERA_XY].matrix(1.0f));
         }
 
-    out += (format == "eps") ? footer_eps() : footer_svg();
+        for (int y = 0; y < m_num_dimensions; ++y)
+            for (int x = 0; x < y; ++x)
+                jobs.push_back({fmt::format("{:s}_{:d}{:d}.{}", basename, x, y, ext),
+                                [params, ext, grids, x, y](FileWriter &out)
+                                { export_points_2d(out, ext, *params, {x, y, 2}, *grids); }});
+    }
 
-    return out;
+    m_export = std::make_unique<ExportTask>(std::move(jobs));
 }
 
 float4x4 CameraParameters::matrix(float window_aspect) const
@@ -1690,15 +2614,81 @@ int main(int argc, char **argv)
     bool           help                 = false;
     bool           error                = false;
     bool           launched_from_finder = false;
+    bool           list                 = false;
+    bool           serve                = false;
+    bool           merge                = false;
+    string         socket_path;
+    string         merged_output;
+    BatchOptions   batch;
 
     try
     {
         for (int i = 1; i < argc; ++i)
         {
-            if (strcmp("--help", argv[i]) == 0 || strcmp("-h", argv[i]) == 0)
+            auto value = [&]() -> string
+            {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument(fmt::format("Missing value for \"{}\"", argv[i]));
+                return argv[++i];
+            };
+            auto is = [&](const char *short_name, const char *long_name)
+            { return (short_name && strcmp(short_name, argv[i]) == 0) || strcmp(long_name, argv[i]) == 0; };
+
+            if (is("-h", "--help"))
                 help = true;
             else if (strncmp("-psn", argv[i], 4) == 0)
                 launched_from_finder = true;
+            else if (is(nullptr, "--list-samplers"))
+                list = true;
+            else if (is("-s", "--sampler"))
+                batch.sampler = value();
+            else if (is("-n", "--num-points"))
+                batch.num_points = std::stoll(value());
+            else if (is("-d", "--dimensions"))
+                batch.num_dimensions = std::stoi(value());
+            else if (is(nullptr, "--seed"))
+                batch.seed = (uint32_t)std::stoul(value());
+            else if (is("-j", "--jitter"))
+                batch.jitter = std::stof(value());
+            else if (is("-t", "--strength"))
+                batch.strength = std::stoi(value());
+            else if (is(nullptr, "--offset-type"))
+                batch.offset_type = value();
+            else if (is("-f", "--format"))
+                batch.format = value();
+            else if (is("-o", "--output"))
+                batch.output = value();
+            else if (is(nullptr, "--fixed-point"))
+                batch.fixed_point = true;
+            else if (is(nullptr, "--double"))
+                batch.double_precision = true;
+            else if (is(nullptr, "--first"))
+                batch.first = std::stoll(value());
+            else if (is(nullptr, "--count"))
+                batch.count = std::stoll(value());
+            else if (is(nullptr, "--shard"))
+            {
+                string shard = value();
+                auto   slash = shard.find('/');
+                if (slash == string::npos)
+                    throw std::invalid_argument(fmt::format("Expected K/N instead of \"{}\"", shard));
+                batch.shard      = std::stoi(shard.substr(0, slash));
+                batch.num_shards = std::stoi(shard.substr(slash + 1));
+            }
+            else if (is(nullptr, "--merge"))
+            {
+                merge         = true;
+                merged_output = value();
+            }
+            else if (is(nullptr, "--verify"))
+                merge = true;
+            else if (is(nullptr, "--serve"))
+            {
+                serve       = true;
+                socket_path = value();
+            }
+            else if (is(nullptr, "--socket"))
+                socket_path = value();
             else
             {
                 if (strncmp(argv[i], "-", 1) == 0)
@@ -1721,12 +2711,56 @@ int main(int argc, char **argv)
     if (help)
     {
         fmt::print(error ? stderr : stdout, R"(Syntax: {} [options]
+Without a sampler, start the interactive viewer. With one, write its points and exit without opening a window.
 Options:
    -h, --help                Display this message
+   --list-samplers           List the names of all samplers
+   -s, --sampler NAME        Generate points with the sampler called NAME (or a unique prefix of it, ignoring case)
+   -n, --num-points N        Number of points to generate (default 256; some samplers round this)
+   -d, --dimensions D        Dimensionality of the points (default 3, if the sampler supports it)
+   --seed S                  Seed used to randomize the points (default 0)
+   -j, --jitter J            Percentage of jitter, for samplers that support it
+   -t, --strength T          Strength of orthogonal arrays
+   --offset-type TYPE        Offset type of orthogonal arrays, by name or index
+   -f, --format FORMAT       Output format: csv (default), pts, or npy
+   -o, --output FILE         Write the points to FILE instead of the standard output
+   --fixed-point             Write the exact 32-bit fixed-point coordinates of digital nets (pts and npy only)
+   --double                  Write double-precision coordinates, which stay distinct past 2^24 points (pts and npy
+                             only)
+   --first I                 Index of the first point to write (default 0)
+   --count C                 Number of points to write (default: all remaining points)
+   --shard K/N               Write only the K-th (counting from 0) of N equal parts of the points, along with a
+                             manifest (the output filename with ".shard" appended) used by --merge and --verify
+   --merge FILE SHARD...     Check that the shards are complete and intact, and concatenate them into FILE
+   --verify SHARD...         Only check that the shards are complete and intact
+   --serve SOCKET            Serve points to other processes over the UNIX domain socket SOCKET
+   --socket SOCKET           Request the points from the server at SOCKET instead of generating them
 )",
                    argv[0]);
         return error ? EXIT_FAILURE : EXIT_SUCCESS;
     }
+    if (list || serve || merge || !batch.sampler.empty())
+    {
+        try
+        {
+            if (list)
+                list_samplers();
+            else if (merge)
+                merge_shards(merged_output, args);
+            else if (serve)
+                serve_samples(socket_path);
+            else if (!socket_path.empty())
+                request_samples(socket_path, batch);
+            else
+                run_batch(batch);
+        }
+        catch (const std::exception &e)
+        {
+            fmt::print(stderr, "Error: {}\n", e.what());
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
     try
     {
         SampleViewer viewer;
@@ -0,0 +1,539 @@
+/** \file batch.cpp
+    \author Wojciech Jarosz
+*/
+
+#include "batch.h"
+
+#include "hello_imgui/hello_imgui.h"
+
+#include <sampler/CSVFile.h>
+#include <sampler/CascadedSobol.h>
+#include <sampler/Faure.h>
+#include <sampler/GrayCode.h>
+#include <sampler/Halton.h>
+#include <sampler/Hammersley.h>
+#include <sampler/Jittered.h>
+#include <sampler/LP.h>
+#include <sampler/MappedFile.h>
+#include <sampler/Misc.h>
+#include <sampler/MultiJittered.h>
+#include <sampler/NRooks.h>
+#include <sampler/OA.h>
+#include <sampler/OAAddelmanKempthorne.h>
+#include <sampler/OABoseBush.h>
+#include <sampler/OABush.h>
+#include <sampler/OACMJND.h>
+#include <sampler/PointFile.h>
+#include <sampler/Random.h>
+#include <sampler/Sobol.h>
+#include <sampler/Sudoku.h>
+#include <sampler/XiSequence.h>
+
+#include "export_to_file.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#endif
+
+using std::string;
+using std::vector;
+
+Sampler *create_sampler(int index, int num_dimensions, float jitter)
+{
+    switch (index)
+    {
+    case 0: return new Random(num_dimensions);
+    case 1: return new Jittered(1, 1, jitter);
+    case 2: return new CorrelatedMultiJitteredInPlace(1, 1, num_dimensions, 0, jitter, false);
+    case 3: return new CorrelatedMultiJitteredInPlace(1, 1, num_dimensions, 0, jitter, true);
+    case 4: return new CMJNDInPlace(1, 3, MJ_STYLE, 0, jitter);
+    case 5: return new SudokuInPlace(1, 1, num_dimensions, 0, 0.0f, false);
+    case 6: return new SudokuInPlace(1, 1, num_dimensions, 0, 0.0f, true);
+    case 7: return new BoseOAInPlace(1, MJ_STYLE, 0, jitter, num_dimensions);
+    case 8: return new BoseGaloisOAInPlace(1, MJ_STYLE, 0, jitter, num_dimensions);
+    case 9: return new BushOAInPlace(1, 3, MJ_STYLE, 0, jitter, num_dimensions);
+    case 10: return new BushGaloisOAInPlace(1, 3, MJ_STYLE, 0, jitter, num_dimensions);
+    case 11: return new AddelmanKempthorneOAInPlace(2, MJ_STYLE, 0, jitter, num_dimensions);
+    case 12: return new BoseBushOAInPlace(2, MJ_STYLE, 0, jitter, num_dimensions);
+    case 13: return new NRooksInPlace(num_dimensions, 1, 0, jitter);
+    case 14: return new Sobol(num_dimensions);
+    case 15: return new SSobol(num_dimensions);
+    case 16: return new ZSobol(num_dimensions);
+    case 17: return new ZeroTwo(1, num_dimensions, false);
+    case 18: return new ZeroTwo(1, num_dimensions, true);
+    case 19: return new CascadedSobol(HelloImGui::assetFileFullPath("cascaded_sobol_init_tab.dat"), num_dimensions);
+    case 20: return new OneTwo(1, num_dimensions, 0);
+    case 21: return new Faure(num_dimensions, 1);
+    case 22: return new Halton(num_dimensions);
+    case 23: return new HaltonZaremba(num_dimensions);
+    case 24: return new Hammersley<Halton>(num_dimensions, 1);
+    case 25: return new Hammersley<HaltonZaremba>(num_dimensions, 1);
+    case 26: return new LarcherPillichshammerGK(3, 1, false);
+    case 27: return new GrayCode(1);
+    case 28: return new XiSequence(1);
+    case 29: return new CSVFile();
+    default: return nullptr;
+    }
+}
+
+vector<Sampler *> create_samplers(int num_dimensions, float jitter)
+{
+    vector<Sampler *> samplers;
+    for (int i = 0; Sampler *s = create_sampler(i, num_dimensions, jitter); ++i) samplers.push_back(s);
+    return samplers;
+}
+
+namespace
+{
+
+// Points are generated and written out in blocks of this many points, so memory use does not grow with their number
+constexpr int BLOCK_SIZE = 1 << 16;
+
+string to_lower(string s)
+{
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return (char)std::tolower(c); });
+    return s;
+}
+
+/// Apply the orthogonal array settings in `options` if `sampler` is an orthogonal array
+void configure_oa(Sampler *sampler, const BatchOptions &options)
+{
+    auto oa = dynamic_cast<OrthogonalArray *>(sampler);
+    if (!oa)
+    {
+        if (options.strength || !options.offset_type.empty())
+            throw std::runtime_error(fmt::format("\"{}\" is not an orthogonal array, so it has no strength or offset "
+                                                 "type",
+                                                 sampler->name()));
+        return;
+    }
+
+    if (options.strength)
+        oa->setStrength(options.strength);
+
+    if (options.offset_type.empty())
+        return;
+
+    auto names = oa->offsetTypeNames();
+    for (unsigned i = 0; i < names.size(); ++i)
+        if (to_lower(names[i]) == to_lower(options.offset_type) || std::to_string(i) == options.offset_type)
+        {
+            oa->setOffsetType(i);
+            return;
+        }
+    throw std::runtime_error(fmt::format("Unknown offset type \"{}\"; choose one of \"{}\"", options.offset_type,
+                                         fmt::join(names, "\", \"")));
+}
+
+/// Open `output` for writing, or the standard output for "-"
+std::unique_ptr<FileWriter> open_output(const string &output)
+{
+    if (output != "-")
+        return std::make_unique<FileWriter>(output);
+
+#ifdef _WIN32
+    // don't let the C library translate line endings in binary data
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    return std::make_unique<FileWriter>(stdout);
+}
+
+/// Return the offset of the first point in `data`, which holds points written by write_points() in `format`, and
+/// optionally their data type
+size_t data_offset(std::string_view data, const string &format, uint32_t *dtype = nullptr)
+{
+    if (dtype)
+        *dtype = PointFileHeader::Float32;
+    if (format == "csv")
+        return 0;
+
+    PointFileInfo info;
+    if (!parsePointFileHeader(data, info))
+        throw std::runtime_error(fmt::format("Missing {} header", format));
+    if (dtype)
+        *dtype = info.dtype;
+    return info.dataOffset;
+}
+
+/// What run_batch() records about each shard it writes, so that merge_shards() can check and reassemble them
+struct ShardManifest
+{
+    string   sampler;
+    string   format;
+    uint32_t seed       = 0;
+    int      dimensions = 0;
+    int      shard      = 0;
+    int      num_shards = 0;
+    int64_t  total      = 0; ///< number of points in all shards together
+    int64_t  first      = 0; ///< index of the first point in this shard
+    int64_t  count      = 0; ///< number of points in this shard
+    uint64_t checksum   = 0; ///< of the points in this shard, excluding any file header
+};
+
+void write_manifest(const string &filename, const ShardManifest &m)
+{
+    FileWriter out(filename);
+    out.format("shard {}\nnum-shards {}\nformat {}\nseed {}\ndimensions {}\ntotal {}\nfirst {}\ncount {}\nchecksum "
+               "{:016x}\nsampler {}\n",
+               m.shard, m.num_shards, m.format, m.seed, m.dimensions, m.total, m.first, m.count, m.checksum, m.sampler);
+}
+
+ShardManifest read_manifest(const string &filename)
+{
+    std::ifstream in(filename);
+    if (!in)
+        throw std::runtime_error(fmt::format("Cannot read the shard manifest \"{}\"", filename));
+
+    ShardManifest m;
+    string        line;
+    int           num_keys = 0;
+    while (std::getline(in, line))
+    {
+        auto   space = line.find(' ');
+        string key   = line.substr(0, space);
+        string value = space == string::npos ? "" : line.substr(space + 1);
+
+        if (key == "shard")
+            m.shard = std::stoi(value);
+        else if (key == "num-shards")
+            m.num_shards = std::stoi(value);
+        else if (key == "format")
+            m.format = value;
+        else if (key == "seed")
+            m.seed = (uint32_t)std::stoul(value);
+        else if (key == "dimensions")
+            m.dimensions = std::stoi(value);
+        else if (key == "total")
+            m.total = std::stoll(value);
+        else if (key == "first")
+            m.first = std::stoll(value);
+        else if (key == "count")
+            m.count = std::stoll(value);
+        else if (key == "checksum")
+            m.checksum = std::stoull(value, nullptr, 16);
+        else if (key == "sampler")
+            m.sampler = value;
+        else
+            continue;
+        ++num_keys;
+    }
+    if (num_keys != 10)
+        throw std::runtime_error(fmt::format("Incomplete shard manifest \"{}\"", filename));
+    return m;
+}
+
+/// The names of all samplers, in the order of create_sampler()
+const vector<string> &sampler_names()
+{
+    static const vector<string> names = []()
+    {
+        vector<string> names;
+        for (auto s : create_samplers(2, 0.8f))
+        {
+            names.push_back(s->name());
+            delete s;
+        }
+        return names;
+    }();
+    return names;
+}
+
+} // namespace
+
+uint64_t point_checksum(std::string_view data)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (unsigned char c : data) hash = (hash ^ c) * 0x100000001b3ull;
+    return hash;
+}
+
+int find_sampler(const string &name)
+{
+    auto  &names       = sampler_names();
+    string lower       = to_lower(name);
+    int    match       = -1;
+    int    num_matches = 0;
+    for (int i = 0; i < (int)names.size(); ++i)
+    {
+        string candidate = to_lower(names[i]);
+        if (candidate == lower)
+            return i;
+        if (candidate.compare(0, lower.size(), lower) == 0)
+        {
+            match = i;
+            ++num_matches;
+        }
+    }
+
+    if (num_matches == 1)
+        return match;
+    throw std::runtime_error(fmt::format("{} sampler \"{}\"; use --list-samplers to see all choices",
+                                         num_matches ? "Ambiguous" : "Unknown", name));
+}
+
+int64_t configure_sampler(Sampler *sampler, const BatchOptions &options)
+{
+    if (options.num_points < 1)
+        throw std::runtime_error("The number of points must be positive");
+
+    unsigned dims = options.num_dimensions ? options.num_dimensions
+                                           : std::clamp(3u, sampler->minDimensions(), sampler->maxDimensions());
+    if (dims < sampler->minDimensions() || dims > sampler->maxDimensions())
+        throw std::runtime_error(fmt::format("\"{}\" supports between {} and {} dimensions", sampler->name(),
+                                             sampler->minDimensions(), sampler->maxDimensions()));
+    sampler->setDimensions(dims);
+    configure_oa(sampler, options);
+    if (options.jitter >= 0.f)
+        sampler->setJitter(options.jitter * 0.01f);
+    if (sampler->seed() != options.seed)
+        sampler->setSeed(options.seed);
+
+    int num_points = sampler->setNumSamples((unsigned)std::min<int64_t>(options.num_points, INT_MAX));
+    if (num_points >= 0)
+        return num_points;
+
+    if (options.num_points > (int64_t(1) << 32) && !sampler->hasLongIndices())
+        throw std::runtime_error(fmt::format("\"{}\" cannot produce more than 2^32 distinct points", sampler->name()));
+    return options.num_points;
+}
+
+void select_points(const BatchOptions &options, int64_t num_points, int64_t &first, int64_t &count)
+{
+    first = std::clamp<int64_t>(options.first, 0, num_points);
+    count = options.count < 0 ? num_points - first : std::min(options.count, num_points - first);
+}
+
+namespace
+{
+
+/// Implements all write_points(), with `T` either float, fixed-point uint32_t, or double coordinates
+template <typename T>
+void write_blocks(const BatchOptions &options, const string &sampler_name, int dims, int64_t count,
+                  const std::function<void(Array2d<T> &, int64_t)> &generate)
+{
+    constexpr bool single = std::is_same_v<T, float>;
+    if (options.format != "csv" && options.format != "pts" && options.format != "npy")
+        throw std::runtime_error(fmt::format("Unknown output format \"{}\"; choose csv, pts, or npy", options.format));
+    if (!single && options.format == "csv")
+        throw std::runtime_error(fmt::format("{} coordinates can only be written in the pts or npy format",
+                                             std::is_same_v<T, double> ? "Double-precision" : "Fixed-point"));
+
+    auto out   = open_output(options.output);
+    auto dtype = single                          ? PointFileHeader::Float32
+                 : std::is_same_v<T, uint32_t> ? PointFileHeader::UInt32
+                                                 : PointFileHeader::Float64;
+
+    if (options.format == "pts")
+        *out << pointFileHeader(count, dims, dtype, sampler_name, options.seed);
+    else if (options.format == "npy")
+        *out << npyHeader(count, dims, dtype);
+
+    // Generate each block while the previous one is being formatted and written, alternating between two buffers.
+    // Samplers are stateful, so the points themselves have to be generated in order on a single thread.
+#ifndef __EMSCRIPTEN__
+    auto policy = std::launch::async;
+#else
+    auto policy = std::launch::deferred;
+#endif
+    Array2d<T>        blocks[2];
+    std::future<void> pending;
+    int b = 0;
+    for (int64_t i = 0; i < count; i += BLOCK_SIZE, b ^= 1)
+    {
+        int   n     = (int)std::min<int64_t>(BLOCK_SIZE, count - i);
+        auto &block = blocks[b];
+        block.resize(dims, n);
+        generate(block, i);
+
+        if (pending.valid())
+            pending.get();
+        pending = std::async(policy,
+                             [&out, &block, n, &options]()
+                             {
+                                 if constexpr (single)
+                                 {
+                                     if (options.format == "csv")
+                                         return draw_points_csv(*out, block, {0, n});
+                                 }
+                                 out->write(std::string_view((const char *)&block(0, 0),
+                                                             size_t(n) * block.sizeX() * sizeof(T)));
+                             });
+    }
+    if (pending.valid())
+        pending.get();
+
+    out->flush();
+}
+
+} // namespace
+
+void write_points(const BatchOptions &options, const string &sampler_name, int dims, int64_t count,
+                  const std::function<void(Array2d<float> &, int64_t)> &generate)
+{
+    write_blocks(options, sampler_name, dims, count, generate);
+}
+
+void write_points(const BatchOptions &options, const string &sampler_name, int dims, int64_t count,
+                  const std::function<void(Array2d<uint32_t> &, int64_t)> &generate)
+{
+    write_blocks(options, sampler_name, dims, count, generate);
+}
+
+void write_points(const BatchOptions &options, const string &sampler_name, int dims, int64_t count,
+                  const std::function<void(Array2d<double> &, int64_t)> &generate)
+{
+    write_blocks(options, sampler_name, dims, count, generate);
+}
+
+void list_samplers()
+{
+    vector<std::unique_ptr<Sampler>> samplers;
+    for (auto s : create_samplers(2, 0.8f)) samplers.emplace_back(s);
+
+    for (auto &s : samplers)
+        fmt::print("{}{}\n", s->name(), dynamic_cast<OrthogonalArray *>(s.get()) ? " (orthogonal array)" : "");
+}
+
+void run_batch(const BatchOptions &options)
+{
+    if (options.num_shards)
+    {
+        if (options.shard < 0 || options.shard >= options.num_shards)
+            throw std::runtime_error(fmt::format("Invalid shard {} of {}", options.shard, options.num_shards));
+        if (options.output == "-")
+            throw std::runtime_error("Shards have to be written to a file");
+    }
+
+    std::unique_ptr<Sampler> sampler(
+        create_sampler(find_sampler(options.sampler), options.num_dimensions ? options.num_dimensions : 3, 0.8f));
+
+    int64_t first, count;
+    select_points(options, configure_sampler(sampler.get(), options), first, count);
+
+    // every point only depends on its index, so each shard can start generating in the middle of the sequence
+    int64_t total = count;
+    if (options.num_shards)
+    {
+        int64_t begin = total * options.shard / options.num_shards;
+        int64_t end   = total * (options.shard + 1) / options.num_shards;
+        first += begin;
+        count = end - begin;
+    }
+
+    if (options.fixed_point && options.double_precision)
+        throw std::runtime_error("Choose either fixed-point or double-precision coordinates");
+
+    if (options.fixed_point)
+        write_points(options, sampler->name(), sampler->dimensions(), count,
+                     [&](Array2d<uint32_t> &block, int64_t i)
+                     {
+                         block.reset(0x80000000u);
+                         sampler->sampleUIntRange(block.row(0), first + i, block.sizeY(), block.sizeX());
+                     });
+    else if (options.double_precision)
+        write_points(options, sampler->name(), sampler->dimensions(), count,
+                     [&](Array2d<double> &block, int64_t i)
+                     {
+                         block.reset(0.5);
+                         sampler->sampleDoubleRange(block.row(0), first + i, block.sizeY(), block.sizeX());
+                     });
+    else
+        write_points(options, sampler->name(), sampler->dimensions(), count,
+                     [&](Array2d<float> &block, int64_t i)
+                     {
+                         block.reset(0.5f);
+                         sampler->sampleRange(block.row(0), first + i, block.sizeY(), block.sizeX());
+                     });
+
+    if (!options.num_shards)
+        return;
+
+    MappedFile file(options.output);
+    auto       data = file.view();
+    data.remove_prefix(data_offset(data, options.format));
+    write_manifest(options.output + ".shard", {sampler->name(), options.format, options.seed,
+                                               (int)sampler->dimensions(), options.shard, options.num_shards, total,
+                                               first, count, point_checksum(data)});
+}
+
+void merge_shards(const string &output, const vector<string> &shards)
+{
+    if (shards.empty())
+        throw std::runtime_error("No shards given");
+
+    vector<ShardManifest> manifests;
+    for (auto &shard : shards) manifests.push_back(read_manifest(shard + ".shard"));
+
+    vector<int> order(shards.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return manifests[a].shard < manifests[b].shard; });
+
+    // the shards have to come from the same run, and cover all of its points exactly once, in order
+    const auto &head = manifests[order[0]];
+    if (head.num_shards != (int)shards.size())
+        throw std::runtime_error(fmt::format("Expected {} shards, but got {}", head.num_shards, shards.size()));
+
+    vector<MappedFile> files(shards.size());
+    int64_t            next  = head.first;
+    uint32_t           dtype = PointFileHeader::Float32;
+    for (int k = 0; k < (int)order.size(); ++k)
+    {
+        const auto &name = shards[order[k]];
+        const auto &m    = manifests[order[k]];
+        if (m.shard != k)
+            throw std::runtime_error(fmt::format("Shard {} of {} is missing", k, head.num_shards));
+        if (m.sampler != head.sampler || m.format != head.format || m.seed != head.seed ||
+            m.dimensions != head.dimensions || m.num_shards != head.num_shards || m.total != head.total)
+            throw std::runtime_error(fmt::format("Shard \"{}\" comes from a different run than \"{}\"", name,
+                                                 shards[order[0]]));
+        if (m.first != next)
+            throw std::runtime_error(fmt::format("Shard \"{}\" starts at point {} instead of {}", name, m.first, next));
+        next += m.count;
+
+        auto &file = files[order[k]];
+        file.open(name);
+        auto     data = file.view();
+        uint32_t shard_dtype;
+        data.remove_prefix(data_offset(data, m.format, &shard_dtype));
+        if (k == 0)
+            dtype = shard_dtype;
+        else if (shard_dtype != dtype)
+            throw std::runtime_error(fmt::format("Shard \"{}\" comes from a different run than \"{}\"", name,
+                                                 shards[order[0]]));
+        size_t value_size = PointFileHeader::valueSize(dtype);
+        if ((m.format != "csv" && data.size() != size_t(m.count) * m.dimensions * value_size) ||
+            point_checksum(data) != m.checksum)
+            throw std::runtime_error(fmt::format("Shard \"{}\" does not match its checksum", name));
+    }
+    if (next - head.first != head.total)
+        throw std::runtime_error(fmt::format("The shards hold {} points instead of {}", next - head.first, head.total));
+
+    if (output.empty())
+    {
+        fmt::print(stderr, "Verified {} shards with {} points\n", shards.size(), head.total);
+        return;
+    }
+
+    auto out = open_output(output);
+    if (head.format == "pts")
+        *out << pointFileHeader(head.total, head.dimensions, dtype, head.sampler, head.seed);
+    else if (head.format == "npy")
+        *out << npyHeader(head.total, head.dimensions, dtype);
+    for (int k : order)
+    {
+        auto data = files[k].view();
+        *out << data.substr(data_offset(data, head.format));
+    }
+    out->flush();
+}
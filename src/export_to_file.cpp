@@ -1,44 +1,101 @@
 #include "export_to_file.h"
-#include <fmt/core.h>
-#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stb_image_write.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
-using std::ofstream;
 using std::string;
 
 static const float svg_page_size = 1000.0f;
 static const float line_size     = 0.001f * svg_page_size;
+static const float svg_quantum   = 0.1f; ///< precision of compact SVG point coordinates, in SVG pixels
 
-string header_eps(const float3 &point_color, float radius)
+FileWriter::FileWriter(const string &filename, const std::atomic<bool> *cancel) : m_filename(filename), m_cancel(cancel)
 {
-    string out;
+    m_file = fopen(filename.c_str(), "wb");
+    if (!m_file)
+        throw std::runtime_error(fmt::format("Cannot open \"{}\" for writing", filename));
+    // we only ever hand large blocks to the C library, so skip its own buffering
+    setvbuf(m_file, nullptr, _IONBF, 0);
+}
+
+FileWriter::~FileWriter()
+{
+    try
+    {
+        flush();
+    }
+    catch (const std::exception &e)
+    {
+        fmt::print(stderr, "{}\n", e.what());
+    }
+    if (m_file && m_owns_file)
+        fclose(m_file);
+}
 
+void FileWriter::write_through(const char *data, size_t size)
+{
+    if (m_string)
+        m_string->append(data, size);
+    else if (size && fwrite(data, 1, size, m_file) != size)
+        throw std::runtime_error(fmt::format("Error writing to \"{}\"", m_filename));
+}
+
+void FileWriter::flush()
+{
+    write_through(m_buffer.data(), m_buffer.size());
+    m_buffer.clear();
+}
+
+void FileWriter::flush_block()
+{
+    if (m_cancel && *m_cancel)
+        throw std::runtime_error(fmt::format("Writing \"{}\" was cancelled", m_filename));
+    flush();
+}
+
+void FileWriter::write(std::string_view data)
+{
+    if (m_buffer.size() + data.size() < BLOCK_SIZE)
+    {
+        m_buffer.append(data.data(), data.data() + data.size());
+        return;
+    }
+
+    flush_block();
+    write_through(data.data(), data.size());
+}
+
+void header_eps(FileWriter &out, const float3 &point_color, float radius)
+{
     float page_size = 0.5f * svg_page_size;
 
-    out += fmt::format("%!PS-Adobe-3.0 EPSF-3.0\n");
-    out += fmt::format("%%HiResBoundingBox: {} {} {} {}\n", -page_size, -page_size, page_size, page_size);
-    out += fmt::format("%%BoundingBox: {} {} {} {}\n", -page_size, -page_size, page_size, page_size);
-    out += fmt::format("%%CropBox: {} {} {} {}\n", -page_size, -page_size, page_size, page_size);
-    out += fmt::format("/radius {{ {} }} def %define variable for point radius\n", radius * page_size);
-    out += fmt::format("/p {{ radius 0 360 arc closepath fill }} def %define point command\n");
-    out += fmt::format("/blw {} def %define variable for bounding box linewidth\n", 2.f);
-    out += fmt::format("/clw {} def %define variable for coarse linewidth\n", line_size);
-    out += fmt::format("/flw {} def %define variable for fine linewidth\n", line_size);
-    out += fmt::format("/pfc {{ {} {} {} }} def %define variable for point fill color\n", point_color.x, point_color.y,
-                       point_color.z);
-    out += fmt::format("/blc {} def %define variable for bounding box color\n", 0.0f);
-    out += fmt::format("/clc {} def %define variable for coarse line color\n", 0.5f);
-    out += fmt::format("/flc {} def %define variable for fine line color\n", 0.9f);
-
-    return out;
+    out.format("%!PS-Adobe-3.0 EPSF-3.0\n");
+    out.format("%%HiResBoundingBox: {} {} {} {}\n", -page_size, -page_size, page_size, page_size);
+    out.format("%%BoundingBox: {} {} {} {}\n", -page_size, -page_size, page_size, page_size);
+    out.format("%%CropBox: {} {} {} {}\n", -page_size, -page_size, page_size, page_size);
+    out.format("/radius {{ {} }} def %define variable for point radius\n", radius * page_size);
+    out.format("/p {{ radius 0 360 arc closepath fill }} def %define point command\n");
+    out.format("/blw {} def %define variable for bounding box linewidth\n", 2.f);
+    out.format("/clw {} def %define variable for coarse linewidth\n", line_size);
+    out.format("/flw {} def %define variable for fine linewidth\n", line_size);
+    out.format("/pfc {{ {} {} {} }} def %define variable for point fill color\n", point_color.x, point_color.y,
+               point_color.z);
+    out.format("/blc {} def %define variable for bounding box color\n", 0.0f);
+    out.format("/clc {} def %define variable for coarse line color\n", 0.5f);
+    out.format("/flc {} def %define variable for fine line color\n", 0.9f);
 }
 
-string footer_eps()
+void footer_eps(FileWriter &out)
 {
-    // return "grestore\n";
-    return "\n";
+    // out << "grestore\n";
+    out << "\n";
 }
 
-string draw_grid_eps(const float4x4 &mvp, int grid_res)
+void draw_grid_eps(FileWriter &out, const float4x4 &mvp, int grid_res)
 {
     float page_size = 500.f;
 
@@ -48,8 +105,6 @@ string draw_grid_eps(const float4x4 &mvp, int grid_res)
     int   fine_grid_res = 2;
     float coarse_scale = 1.f / grid_res, fine_scale = 1.f / fine_grid_res;
 
-    string out;
-
     // draw the outer border of the grid
     {
         float4 c004d = mul(mvp, float4{0.f - 0.5f, 0.f - 0.5f, 0.f, 1.f});
@@ -61,21 +116,21 @@ string draw_grid_eps(const float4x4 &mvp, int grid_res)
         float2 c11   = float2(c114d.x / c114d.w, c114d.y / c114d.w) * page_size;
         float2 c01   = float2(c014d.x / c014d.w, c014d.y / c014d.w) * page_size;
 
-        out += fmt::format(R"(newpath
+        out.format(R"(newpath
     {} {} moveto
     {} {} lineto
     {} {} lineto
     {} {} lineto
 closepath stroke
 )",
-                           c00.x, c00.y, c10.x, c10.y, c11.x, c11.y, c01.x, c01.y);
+                   c00.x, c00.y, c10.x, c10.y, c11.x, c11.y, c01.x, c01.y);
     }
 
     // draw the inner lines of the grid
     for (int i = 1; i <= grid_res - 1; ++i)
     {
         // draw horizontal lines
-        out += "newpath\n";
+        out << "newpath\n";
         for (int j = 0; j < fine_grid_res; ++j)
         {
             vA4d = mul(mvp, float4{j * fine_scale - 0.5f, i * coarse_scale - 0.5f, 0.0f, 1.0f});
@@ -84,13 +139,13 @@ closepath stroke
             vA = float2{vA4d.x / vA4d.w, vA4d.y / vA4d.w} * page_size;
             vB = float2{vB4d.x / vB4d.w, vB4d.y / vB4d.w} * page_size;
 
-            out += fmt::format("    {} {} {:s}\n", vA.x, vA.y, (j == 0) ? "moveto" : "lineto");
-            out += fmt::format("    {} {} lineto\n", vB.x, vB.y);
+            out.format("    {} {} {:s}\n", vA.x, vA.y, (j == 0) ? "moveto" : "lineto");
+            out.format("    {} {} lineto\n", vB.x, vB.y);
         }
-        out += "stroke\n";
+        out << "stroke\n";
 
         // draw vertical lines
-        out += "newpath\n";
+        out << "newpath\n";
         for (int j = 0; j < fine_grid_res; ++j)
         {
             vA4d = mul(mvp, float4{i * coarse_scale - 0.5f, j * fine_scale - 0.5f, 0.0f, 1.0f});
@@ -99,73 +154,64 @@ closepath stroke
             vA = float2{vA4d.x / vA4d.w, vA4d.y / vA4d.w} * page_size;
             vB = float2{vB4d.x / vB4d.w, vB4d.y / vB4d.w} * page_size;
 
-            out += fmt::format("    {} {} {:s}\n", vA.x, vA.y, (j == 0) ? "moveto" : "lineto");
-            out += fmt::format("    {} {} lineto\n", vB.x, vB.y);
+            out.format("    {} {} {:s}\n", vA.x, vA.y, (j == 0) ? "moveto" : "lineto");
+            out.format("    {} {} lineto\n", vB.x, vB.y);
         }
-        out += "stroke\n";
+        out << "stroke\n";
     }
-    return out;
 }
 
-string draw_grids_eps(float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid, bool bbox)
+void draw_grids_eps(FileWriter &out, float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid,
+                    bool bbox)
 {
-    string out;
     if (fine_grid)
     {
-        out += "% Draw fine grids \n";
-        out += "flc setgray %fill color for fine grid \n";
-        out += "flw setlinewidth\n";
+        out << "% Draw fine grids \n";
+        out << "flc setgray %fill color for fine grid \n";
+        out << "flw setlinewidth\n";
 
         // this extra matrix multiply is needed to properly rotate the different grids for the XYZ view
-        out += draw_grid_eps(mat, fgrid_res);
+        draw_grid_eps(out, mat, fgrid_res);
     }
 
     if (coarse_grid)
     {
-        out += "% Draw coarse grids \n";
-        out += "clc setgray %fill color for coarse grid \n";
-        out += "clw setlinewidth\n";
+        out << "% Draw coarse grids \n";
+        out << "clc setgray %fill color for coarse grid \n";
+        out << "clw setlinewidth\n";
 
-        out += draw_grid_eps(mat, cgrid_res);
+        draw_grid_eps(out, mat, cgrid_res);
     }
 
     if (bbox)
     {
-        out += "% Draw bounding boxes \n";
-        out += "blc setgray %fill color for bounding box \n";
-        out += "blw setlinewidth\n";
-        out += draw_grid_eps(mat, 1);
+        out << "% Draw bounding boxes \n";
+        out << "blc setgray %fill color for bounding box \n";
+        out << "blw setlinewidth\n";
+        draw_grid_eps(out, mat, 1);
     }
-
-    return out;
 }
 
-string draw_points_eps(float4x4 mat, int3 dim, const Array2d<float> &points, int2 range)
+void draw_points_eps(FileWriter &out, float4x4 mat, int3 dim, const Array2d<float> &points, int2 range)
 {
-    string out;
-
     float page_size = 0.5f * svg_page_size;
 
     // Render the point set
-    out += "% Draw points \n";
-    out += "pfc setrgbcolor %fill color for points\n";
+    out << "% Draw points \n";
+    out << "pfc setrgbcolor %fill color for points\n";
 
     for (int i = range.x; i < range.x + range.y; ++i)
     {
         auto v4d =
             mul(mat, float4{points(dim.x, i), points(dim.y, i), points(dim.z, i), 1.0f} - float4{float3{0.5f}, 0.f});
         auto v2d = float2{v4d.x / v4d.w, v4d.y / v4d.w} * page_size;
-        out += fmt::format("{} {} p\n", v2d.x, v2d.y);
+        out.format("{} {} p\n", v2d.x, v2d.y);
     }
-
-    return out;
 }
 
-string header_svg(const float3 &point_color)
+void header_svg(FileWriter &out, const float3 &point_color)
 {
-    string out;
-
-    out += fmt::format(R"_(<svg
+    out.format(R"_(<svg
     width="{}px"
     height="{}px"
     viewBox="{} {} {} {}"
@@ -179,6 +225,13 @@ string header_svg(const float3 &point_color)
         fill: rgb({}, {}, {});
     }}
 
+    .points
+    {{
+        fill: none;
+        stroke: rgb({}, {}, {});
+        stroke-linecap: round;
+    }}
+
     .fine_grid
     {{
         fill: none;
@@ -204,13 +257,40 @@ string header_svg(const float3 &point_color)
     }}
 </style>
 )_",
-                       svg_page_size, svg_page_size, -svg_page_size * 0.5f, -svg_page_size * 0.5f, svg_page_size,
-                       svg_page_size, int(point_color.x * 255), int(point_color.y * 255), int(point_color.z * 255),
-                       0.001f * svg_page_size, 0.001f * svg_page_size, 0.001f * svg_page_size);
-    return out;
+               svg_page_size, svg_page_size, -svg_page_size * 0.5f, -svg_page_size * 0.5f, svg_page_size, svg_page_size,
+               int(point_color.x * 255), int(point_color.y * 255), int(point_color.z * 255), int(point_color.x * 255),
+               int(point_color.y * 255), int(point_color.z * 255), 0.001f * svg_page_size, 0.001f * svg_page_size,
+               0.001f * svg_page_size);
+}
+
+/// Interleave the bits of x and y
+static uint64_t morton_encode(uint32_t x, uint32_t y)
+{
+    auto spread = [](uint64_t v)
+    {
+        v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+        v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+        v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+        v = (v | (v << 2)) & 0x3333333333333333ull;
+        v = (v | (v << 1)) & 0x5555555555555555ull;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1);
 }
 
-string draw_grid_svg(const float4x4 &mvp, int grid_res, const string &css_class)
+/// Extract the even bits of a Morton code (shift it right by one to get the odd bits)
+static uint32_t morton_decode(uint64_t v)
+{
+    v &= 0x5555555555555555ull;
+    v = (v | (v >> 1)) & 0x3333333333333333ull;
+    v = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+    v = (v | (v >> 4)) & 0x00FF00FF00FF00FFull;
+    v = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+    v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+    return uint32_t(v);
+}
+
+void draw_grid_svg(FileWriter &out, const float4x4 &mvp, int grid_res, const string &css_class)
 {
     float4 vA4d, vB4d;
     float2 vA, vB;
@@ -218,7 +298,6 @@ string draw_grid_svg(const float4x4 &mvp, int grid_res, const string &css_class)
     float scale     = 1.f / grid_res;
     float page_size = 0.5f * svg_page_size;
 
-    string out;
 
     // draw the outer border of the grid
     {
@@ -231,9 +310,9 @@ string draw_grid_svg(const float4x4 &mvp, int grid_res, const string &css_class)
         float2 c11   = float2{c114d.x / c114d.w, c114d.y / c114d.w} * float2{page_size, -page_size};
         float2 c01   = float2{c014d.x / c014d.w, c014d.y / c014d.w} * float2{page_size, -page_size};
 
-        out += fmt::format(R"(    <polygon points="{},{} {},{} {},{} {},{}" class="{}" />)", c00.x, c00.y, c10.x, c10.y,
-                           c11.x, c11.y, c01.x, c01.y, css_class);
-        out += "\n";
+        out.format(R"(    <polygon points="{},{} {},{} {},{} {},{}" class="{}" />)", c00.x, c00.y, c10.x, c10.y,
+                   c11.x, c11.y, c01.x, c01.y, css_class);
+        out << "\n";
     }
 
     // draw the inner lines of the grid
@@ -244,69 +323,378 @@ string draw_grid_svg(const float4x4 &mvp, int grid_res, const string &css_class)
         vB4d = mul(mvp, float4{1.f - 0.5f, i * scale - 0.5f, 0.0f, 1.0f});
         vA   = float2(vA4d.x / vA4d.w, vA4d.y / vA4d.w) * float2{page_size, -page_size};
         vB   = float2(vB4d.x / vB4d.w, vB4d.y / vB4d.w) * float2{page_size, -page_size};
-        out += fmt::format(R"(    <polygon points="{},{} {},{}" class="{}" />)", vA.x, vA.y, vB.x, vB.y, css_class);
-        out += "\n";
+        out.format(R"(    <polygon points="{},{} {},{}" class="{}" />)", vA.x, vA.y, vB.x, vB.y, css_class);
+        out << "\n";
 
         // draw vertical lines
         vA4d = mul(mvp, float4{i * scale - 0.5f, 0.f - 0.5f, 0.0f, 1.0f});
         vB4d = mul(mvp, float4{i * scale - 0.5f, 1.f - 0.5f, 0.0f, 1.0f});
         vA   = float2(vA4d.x / vA4d.w, vA4d.y / vA4d.w) * float2{page_size, -page_size};
         vB   = float2(vB4d.x / vB4d.w, vB4d.y / vB4d.w) * float2{page_size, -page_size};
-        out += fmt::format(R"(    <polygon points="{},{} {},{}" class="{}" />)", vA.x, vA.y, vB.x, vB.y, css_class);
-        out += "\n";
+        out.format(R"(    <polygon points="{},{} {},{}" class="{}" />)", vA.x, vA.y, vB.x, vB.y, css_class);
+        out << "\n";
     }
-    return out;
 }
 
-string draw_grids_svg(float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid, bool bbox)
+void draw_grids_svg(FileWriter &out, float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid,
+                    bool bbox)
 {
-    string out;
     if (fine_grid)
-        out += draw_grid_svg(mat, fgrid_res, "fine_grid");
+        draw_grid_svg(out, mat, fgrid_res, "fine_grid");
 
     if (coarse_grid)
-        out += draw_grid_svg(mat, cgrid_res, "coarse_grid");
+        draw_grid_svg(out, mat, cgrid_res, "coarse_grid");
 
     if (bbox)
-        out += draw_grid_svg(mat, 1, "bbox");
-
-    return out;
+        draw_grid_svg(out, mat, 1, "bbox");
 }
 
-string draw_points_svg(float4x4 mat, int3 dim, const Array2d<float> &points, int2 range, float radius)
+void draw_points_svg(FileWriter &out, float4x4 mat, int3 dim, const Array2d<float> &points, int2 range, float radius,
+                     bool compact)
 {
-    string out;
-    float  page_size = 0.5f * svg_page_size;
+    float page_size = 0.5f * svg_page_size;
+
+    if (compact)
+    {
+        // Draw all points as zero-length subpaths with round caps in a single path. Coordinates are quantized to
+        // integer multiples of svg_quantum, and visited in Morton order so that the offset from one point to the next,
+        // which is all the path stores, stays small.
+        float                 r     = radius * page_size;
+        long                  limit = std::lround((page_size + r) / svg_quantum);
+        std::vector<uint64_t> keys;
+        keys.reserve(range.y);
+        for (int i = range.x; i < range.x + range.y; ++i)
+        {
+            auto v4d = mul(mat, float4{points(dim.x, i), points(dim.y, i), points(dim.z, i), 1.0f} -
+                                    float4{float3{0.5f}, 0.f});
+            // skip points that would not be visible on the page
+            float2 p = float2{v4d.x, -v4d.y} / v4d.w * page_size / svg_quantum;
+            if (!(v4d.w > 0.f && std::abs(p.x) <= limit && std::abs(p.y) <= limit))
+                continue;
+
+            long qx = std::lround(p.x), qy = std::lround(p.y);
+
+            keys.push_back(morton_encode(uint32_t(qx + limit), uint32_t(qy + limit)));
+        }
+        std::sort(keys.begin(), keys.end());
+
+        out.format("    <path class=\"points\" transform=\"scale({})\" stroke-width=\"{}\" d=\"M0 0", svg_quantum,
+                   2.f * r / svg_quantum);
+        long x = 0, y = 0;
+        for (auto key : keys)
+        {
+            long qx = long(morton_decode(key)) - limit, qy = long(morton_decode(key >> 1)) - limit;
+
+            // this loop dominates the export, so assemble "m<dx> <dy>h0" by hand instead of through out.format()
+            char  cmd[48] = {'m'};
+            char *c       = cmd + 1;
+            for (long d : {qx - x, qy - y})
+            {
+                // a minus sign also separates numbers, so only non-negative values need a space
+                if (c != cmd + 1 && d >= 0)
+                    *c++ = ' ';
+                fmt::format_int digits(d);
+                c = std::copy_n(digits.data(), digits.size(), c);
+            }
+            *c++ = 'h';
+            *c++ = '0';
+            out.write(std::string_view(cmd, c - cmd));
+            x = qx;
+            y = qy;
+        }
+        out << "\"/>\n";
+        return;
+    }
 
     for (int i = range.x; i < range.x + range.y; ++i)
     {
         auto v4d =
             mul(mat, float4{points(dim.x, i), points(dim.y, i), points(dim.z, i), 1.0f} - float4{float3{0.5f}, 0.f});
         auto v2d = float2{v4d.x / v4d.w, v4d.y / v4d.w} * float2{page_size, -page_size};
-        out += fmt::format("    <circle cx=\"{}\" cy=\"{}\" r=\"{}\"/>\n", v2d.x, v2d.y, radius * page_size);
+        out.format("    <circle cx=\"{}\" cy=\"{}\" r=\"{}\"/>\n", v2d.x, v2d.y, radius * page_size);
     }
-
-    return out;
 }
 
-string footer_svg()
+void footer_svg(FileWriter &out)
 {
-    return "</svg>";
+    out << "</svg>";
 }
 
-string draw_points_csv(const Array2d<float> &points, int2 range)
+void draw_points_csv(FileWriter &out, const Array2d<float> &points, int2 range)
 {
-    string out;
     for (int i = range.x; i < range.x + range.y; ++i)
     {
-        for (int d = 0; d < points.sizeY(); ++d)
+        for (int d = 0; d < points.sizeX(); ++d)
         {
             if (d > 0)
-                out += ", ";
-            out += fmt::format("{}", points(d, i));
+                out << ", ";
+            out.format("{}", points(d, i));
         }
-        out += "\n";
+        out << "\n";
     }
+}
 
-    return out;
-}
\ No newline at end of file
+/// Write the float coordinates of points [range.x, range.x + range.y) as one contiguous block
+static void draw_points_binary(FileWriter &out, const Array2d<float> &points, int2 range)
+{
+    // rows are stored contiguously, and all supported platforms are little endian
+    if (range.y > 0)
+        out.write(
+            std::string_view((const char *)&points(0, range.x), size_t(range.y) * points.sizeX() * sizeof(float)));
+}
+
+void draw_points_pts(FileWriter &out, const Array2d<float> &points, int2 range, const string &sampler, uint32_t seed)
+{
+    out << pointFileHeader(range.y, points.sizeX(), PointFileHeader::Float32, sampler, seed);
+    draw_points_binary(out, points, range);
+}
+
+void draw_points_npy(FileWriter &out, const Array2d<float> &points, int2 range)
+{
+    out << npyHeader(range.y, points.sizeX(), PointFileHeader::Float32);
+    draw_points_binary(out, points, range);
+}
+
+/// Call `f(i)` for all i in [0,n), spread over all available cores
+template <typename F>
+static void parallel_for(int n, const F &f)
+{
+#ifndef __EMSCRIPTEN__
+    int num_threads = std::min((int)std::thread::hardware_concurrency(), n);
+    if (num_threads > 1)
+    {
+        std::atomic<int>         next{0};
+        auto                     work = [&]() { for (int i; (i = next++) < n;) f(i); };
+        std::vector<std::thread> threads;
+        for (int t = 1; t < num_threads; ++t) threads.emplace_back(work);
+        work();
+        for (auto &t : threads) t.join();
+        return;
+    }
+#endif
+    for (int i = 0; i < n; ++i) f(i);
+}
+
+/// Map a clip-space position to pixel coordinates of the raster (with y pointing down)
+static float2 to_pixel(const Raster &raster, const float4 &v)
+{
+    return float2{1.f + v.x / v.w, 1.f - v.y / v.w} * 0.5f * float(raster.size);
+}
+
+/// Composite an anti-aliased line of `width` pixels in black with the given opacity over the raster
+static void draw_line_png(Raster &raster, float2 a, float2 b, float width, float opacity)
+{
+    // walk along the major axis of the line, visiting each pixel once
+    bool steep = std::abs(b.y - a.y) > std::abs(b.x - a.x);
+    if (steep)
+    {
+        std::swap(a.x, a.y);
+        std::swap(b.x, b.y);
+    }
+    if (a.x > b.x)
+        std::swap(a, b);
+
+    float len = length(b - a);
+    if (!(len > 0.f))
+        return;
+
+    float  half  = 0.5f * width;
+    float2 dir   = (b - a) / len;
+    float  reach = (half + 1.f) / dir.x; // extent along the minor axis
+    int    x0 = std::max(0, int(std::floor(a.x - half - 1.f))), x1 = std::min(raster.size - 1, int(b.x + half + 1.f));
+    for (int x = x0; x <= x1; ++x)
+    {
+        float center = a.y + (x + 0.5f - a.x) * dir.y / dir.x;
+        int   y0 = std::max(0, int(std::floor(center - reach))), y1 = std::min(raster.size - 1, int(center + reach));
+        for (int y = y0; y <= y1; ++y)
+        {
+            // distance to the segment, which gives the line round caps
+            float2 p        = float2{x + 0.5f, y + 0.5f} - a;
+            float  dist     = length(p - dir * std::clamp(dot(p, dir), 0.f, len));
+            float  coverage = std::clamp(half + 0.5f - dist, 0.f, 1.f) * opacity;
+
+            float4 &pixel = raster.pixels[steep ? size_t(x) * raster.size + y : size_t(y) * raster.size + x];
+            pixel *= 1.f - coverage;
+            pixel.w += coverage;
+        }
+    }
+}
+
+static void draw_grid_png(Raster &raster, const float4x4 &mvp, int grid_res, float width, float opacity)
+{
+    auto project = [&](float x, float y) { return to_pixel(raster, mul(mvp, float4{x - 0.5f, y - 0.5f, 0.f, 1.f})); };
+
+    // draw the outer border of the grid
+    float2 c00 = project(0.f, 0.f), c10 = project(1.f, 0.f), c11 = project(1.f, 1.f), c01 = project(0.f, 1.f);
+    draw_line_png(raster, c00, c10, width, opacity);
+    draw_line_png(raster, c10, c11, width, opacity);
+    draw_line_png(raster, c11, c01, width, opacity);
+    draw_line_png(raster, c01, c00, width, opacity);
+
+    // draw the inner lines of the grid
+    float scale = 1.f / grid_res;
+    for (int i = 1; i <= grid_res - 1; ++i)
+    {
+        draw_line_png(raster, project(0.f, i * scale), project(1.f, i * scale), width, opacity);
+        draw_line_png(raster, project(i * scale, 0.f), project(i * scale, 1.f), width, opacity);
+    }
+}
+
+void draw_grids_png(Raster &raster, float4x4 mat, int fgrid_res, int cgrid_res, bool fine_grid, bool coarse_grid,
+                    bool bbox)
+{
+    // same line width and opacities as the SVG export
+    float width = std::max(1.f, line_size / svg_page_size * raster.size);
+
+    if (fine_grid)
+        draw_grid_png(raster, mat, fgrid_res, width, 0.2f);
+
+    if (coarse_grid)
+        draw_grid_png(raster, mat, cgrid_res, width, 0.6f);
+
+    if (bbox)
+        draw_grid_png(raster, mat, 1, width, 1.0f);
+}
+
+void draw_points_png(Raster &raster, float4x4 mat, int3 dim, const Array2d<float> &points, int2 range, float radius,
+                     const float3 &color, bool density)
+{
+    if (range.y <= 0)
+        return;
+
+    static const int tile_size = 128;
+    int              tiles     = (raster.size + tile_size - 1) / tile_size;
+    int              num_tiles = tiles * tiles;
+
+    // discs smaller than a pixel are drawn pixel-sized, but proportionally fainter
+    float r      = radius * 0.5f * raster.size;
+    float r_draw = std::max(r, 0.5f);
+    float weight = (r / r_draw) * (r / r_draw);
+    float reach  = r_draw + 0.5f;
+
+    // the pixels (inclusive) that a disc centered at p could touch; clamping first allows rounding down by truncation
+    auto bounds = [&](float2 p)
+    {
+        float2 lo = p - reach, hi = p + reach;
+        return int4{int(std::max(lo.x, 0.f)), int(std::max(lo.y, 0.f)),
+                    hi.x < 0.f ? -1 : int(std::min(hi.x, raster.size - 1.f)),
+                    hi.y < 0.f ? -1 : int(std::min(hi.y, raster.size - 1.f))};
+    };
+
+    // Sort the points into tiles with a parallel counting sort: project the points and count how many touch each tile
+    // for every chunk of points, and then let each chunk scatter its points into its own part of every tile's list.
+    int                   chunk_size = 1 << 16;
+    int                   num_chunks = (range.y + chunk_size - 1) / chunk_size;
+    std::vector<float2>   pixel(range.y);
+    std::vector<uint32_t> counts(size_t(num_chunks) * num_tiles, 0);
+    parallel_for(num_chunks,
+                 [&](int c)
+                 {
+                     uint32_t *count = &counts[size_t(c) * num_tiles];
+                     for (int i = c * chunk_size; i < std::min(range.y, (c + 1) * chunk_size); ++i)
+                     {
+                         int  j   = range.x + i;
+                         auto v4d = mul(mat, float4{points(dim.x, j), points(dim.y, j), points(dim.z, j), 1.0f} -
+                                                 float4{float3{0.5f}, 0.f});
+                         auto p   = to_pixel(raster, v4d);
+                         auto b   = bounds(p);
+                         // mark points that would not be visible
+                         if (!(v4d.w > 0.f && b.x <= b.z && b.y <= b.w))
+                             p = float2{NAN};
+                         else
+                             for (int ty = b.y / tile_size; ty <= b.w / tile_size; ++ty)
+                                 for (int tx = b.x / tile_size; tx <= b.z / tile_size; ++tx) ++count[ty * tiles + tx];
+                         pixel[i] = p;
+                     }
+                 });
+
+    // offsets are tile-major, so each tile's points end up contiguous and in their original order
+    std::vector<size_t> offsets(counts.size()), tile_start(num_tiles + 1);
+    size_t              total = 0;
+    for (int t = 0; t < num_tiles; ++t)
+    {
+        tile_start[t] = total;
+        for (int c = 0; c < num_chunks; ++c)
+        {
+            offsets[size_t(c) * num_tiles + t] = total;
+            total += counts[size_t(c) * num_tiles + t];
+        }
+    }
+    tile_start[num_tiles] = total;
+    counts                = {};
+
+    // copy the positions themselves, so that rendering a tile reads its points sequentially
+    std::vector<float2> entries(total);
+    parallel_for(num_chunks,
+                 [&](int c)
+                 {
+                     size_t *offset = &offsets[size_t(c) * num_tiles];
+                     for (int i = c * chunk_size; i < std::min(range.y, (c + 1) * chunk_size); ++i)
+                     {
+                         if (std::isnan(pixel[i].x))
+                             continue;
+                         auto b = bounds(pixel[i]);
+                         for (int ty = b.y / tile_size; ty <= b.w / tile_size; ++ty)
+                             for (int tx = b.x / tile_size; tx <= b.z / tile_size; ++tx)
+                                 entries[offset[ty * tiles + tx]++] = pixel[i];
+                     }
+                 });
+    pixel   = {};
+    offsets = {};
+
+    // Accumulate the coverage of all discs, one tile at a time. This is either the summed coverage, or the fraction of
+    // each pixel that remains uncovered.
+    std::vector<float> accum(size_t(raster.size) * raster.size, density ? 0.f : 1.f);
+    parallel_for(num_tiles,
+                 [&](int t)
+                 {
+                     int2 lo{(t % tiles) * tile_size, (t / tiles) * tile_size};
+                     int2 hi = min(lo + tile_size, int2{raster.size}) - 1;
+                     for (size_t e = tile_start[t]; e < tile_start[t + 1]; ++e)
+                     {
+                         float2 p = entries[e];
+                         auto   b = bounds(p);
+                         for (int y = std::max(b.y, lo.y); y <= std::min(b.w, hi.y); ++y)
+                             for (int x = std::max(b.x, lo.x); x <= std::min(b.z, hi.x); ++x)
+                             {
+                                 float2 d = float2{x + 0.5f, y + 0.5f} - p;
+                                 if (dot(d, d) >= reach * reach)
+                                     continue;
+                                 float  coverage = std::min(reach - length(d), 1.f) * weight;
+                                 float &a        = accum[size_t(y) * raster.size + x];
+                                 a               = density ? a + coverage : a * (1.f - coverage);
+                             }
+                     }
+                 });
+
+    // composite the points over the raster
+    float norm = 0.f;
+    if (density)
+        norm = 1.f / std::log1p(std::max(1e-6f, *std::max_element(accum.begin(), accum.end())));
+    parallel_for(raster.size,
+                 [&](int y)
+                 {
+                     for (size_t i = size_t(y) * raster.size; i < size_t(y + 1) * raster.size; ++i)
+                     {
+                         float alpha      = density ? std::log1p(accum[i]) * norm : 1.f - accum[i];
+                         raster.pixels[i] = float4{color * alpha, alpha} + raster.pixels[i] * (1.f - alpha);
+                     }
+                 });
+}
+
+void write_png(FileWriter &out, const Raster &raster)
+{
+    std::vector<uint8_t> rgba(raster.pixels.size() * 4);
+    for (size_t i = 0; i < raster.pixels.size(); ++i)
+    {
+        float4 p = raster.pixels[i];
+        float3 c = p.w > 0.f ? p.xyz() / p.w : float3{0.f};
+        for (int k = 0; k < 4; ++k)
+            rgba[4 * i + k] = uint8_t(std::lround(std::clamp(k < 3 ? c[k] : p.w, 0.f, 1.f) * 255.f));
+    }
+
+    auto write = [](void *context, void *data, int size)
+    { static_cast<FileWriter *>(context)->write(std::string_view((const char *)data, size)); };
+    if (!stbi_write_png_to_func(write, &out, raster.size, raster.size, 4, rgba.data(), raster.size * 4))
+        throw std::runtime_error("Cannot encode the PNG image");
+}
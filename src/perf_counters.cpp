@@ -0,0 +1,138 @@
+/** \file perf_counters.cpp
+    \author Wojciech Jarosz
+*/
+
+#include "perf_counters.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fmt/format.h>
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define HAVE_PERF_EVENTS 1
+#endif
+
+PerfCounts &PerfCounts::operator+=(const PerfCounts &other)
+{
+    auto add = [](std::optional<uint64_t> &total, const std::optional<uint64_t> &count)
+    {
+        if (count)
+            total = total.value_or(0) + *count;
+    };
+    add(cycles, other.cycles);
+    add(instructions, other.instructions);
+    add(cache_misses, other.cache_misses);
+    add(branch_misses, other.branch_misses);
+    return *this;
+}
+
+std::string PerfCounts::per_point_summary(int64_t num_points) const
+{
+    if (!valid())
+        return "no hardware counters";
+
+    double      n = double(std::max<int64_t>(num_points, 1));
+    std::string summary;
+    auto        add = [&](const std::optional<uint64_t> &count, const char *name)
+    {
+        if (count)
+            summary += fmt::format("{}{:.1f} {}", summary.empty() ? "" : ", ", *count / n, name);
+    };
+    add(cycles, "cycles");
+    add(instructions, "instructions");
+    add(cache_misses, "cache misses");
+    add(branch_misses, "branch misses");
+    summary += " per point";
+    if (ipc() > 0.0)
+        summary += fmt::format(" ({:.2f} instructions per cycle)", ipc());
+    return summary;
+}
+
+#if HAVE_PERF_EVENTS
+
+PerfCounters::PerfCounters()
+{
+    const uint64_t configs[NUM_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    for (int c = 0; c < NUM_COUNTERS; ++c)
+    {
+        perf_event_attr attr{};
+        attr.size           = sizeof(attr);
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.config         = configs[c];
+        attr.disabled       = c == 0; // the leader starts and stops the whole group
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        m_fds[c] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, c == 0 ? -1 : m_fds[0], 0);
+        // without a leader there is no group; a missing member just leaves that count empty
+        if (c == 0 && m_fds[c] < 0)
+        {
+            m_error = fmt::format("perf_event_open failed: {}", std::strerror(errno));
+            return;
+        }
+    }
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (int fd : m_fds)
+        if (fd >= 0)
+            close(fd);
+}
+
+void PerfCounters::start()
+{
+    if (!available())
+        return;
+    ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfCounts PerfCounters::stop()
+{
+    PerfCounts counts;
+    if (!available())
+        return counts;
+    ioctl(m_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // the number of counters, the times the group was enabled and running, and one value per opened counter
+    uint64_t data[3 + NUM_COUNTERS];
+    if (read(m_fds[0], data, sizeof(data)) < ssize_t(3 * sizeof(uint64_t)) || data[2] == 0)
+        return counts;
+    double scale = double(data[1]) / data[2];
+
+    std::optional<uint64_t> *fields[NUM_COUNTERS] = {&counts.cycles, &counts.instructions, &counts.cache_misses,
+                                                     &counts.branch_misses};
+    for (int c = 0, v = 0; c < NUM_COUNTERS && v < int(data[0]); ++c)
+        if (m_fds[c] >= 0)
+            *fields[c] = uint64_t(data[3 + v++] * scale + 0.5);
+    return counts;
+}
+
+#else
+
+PerfCounters::PerfCounters() : m_error("hardware counters are only supported on Linux")
+{
+}
+
+PerfCounters::~PerfCounters()
+{
+}
+
+void PerfCounters::start()
+{
+}
+
+PerfCounts PerfCounters::stop()
+{
+    return {};
+}
+
+#endif
@@ -0,0 +1,107 @@
+/** \file profiler.cpp
+    \author Wojciech Jarosz
+*/
+
+#include "profiler.h"
+#include "export_to_file.h"
+
+#include <algorithm>
+
+namespace
+{
+
+/// Small sequential id of the calling thread
+int thread_id()
+{
+    static std::atomic<int> next{0};
+    thread_local int        id = next++;
+    return id;
+}
+
+/// Number of zones currently open on the calling thread
+thread_local int g_depth = 0;
+
+} // namespace
+
+Profiler &Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler() : m_epoch(Clock::now())
+{
+}
+
+void Profiler::new_frame()
+{
+    int64_t                     t = now();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_enabled)
+    {
+        m_current.end = t;
+        m_history.push_back(std::move(m_current));
+        while ((int)m_history.size() > m_history_size) m_history.pop_front();
+    }
+
+    uint64_t index = m_current.index + 1;
+    m_current      = Frame{index, t, t, {}};
+}
+
+void Profiler::set_history_size(int frames)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_history_size = std::max(frames, 1);
+    while ((int)m_history.size() > m_history_size) m_history.pop_front();
+}
+
+std::vector<Profiler::Frame> Profiler::frames() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return {m_history.begin(), m_history.end()};
+}
+
+void Profiler::record(const Zone &zone)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_current.zones.push_back(zone);
+}
+
+void Profiler::write_chrome_trace(FileWriter &out) const
+{
+    // timestamps are in microseconds
+    auto event = [&out, first = true](const char *name, int thread, int64_t start, int64_t end) mutable
+    {
+        out.format("{}\n{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}",
+                   first ? "" : ",", name, thread, start * 1e-3, (end - start) * 1e-3);
+        first = false;
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (auto &frame : frames())
+    {
+        // the frames themselves are shown on their own row, above the zones of the main thread
+        event("frame", -1, frame.start, frame.end);
+        for (auto &zone : frame.zones) event(zone.name, zone.thread, zone.start, zone.end);
+    }
+    out << "\n]}\n";
+    out.flush();
+}
+
+ProfileZone::ProfileZone(const char *name) : m_name(name)
+{
+    auto &profiler = Profiler::instance();
+    if (!profiler.enabled())
+        return;
+    ++g_depth;
+    m_start = profiler.now();
+}
+
+ProfileZone::~ProfileZone()
+{
+    if (m_start < 0)
+        return;
+    auto &profiler = Profiler::instance();
+    --g_depth;
+    profiler.record({m_name, g_depth, thread_id(), m_start, profiler.now()});
+}
@@ -0,0 +1,423 @@
+/** \file sample_server.cpp
+    \author Wojciech Jarosz
+*/
+
+#include "sample_server.h"
+
+#include <fmt/core.h>
+#include <sampler/PointFile.h>
+#include <sampler/Sampler.h>
+
+#include <stdexcept>
+
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+
+void serve_samples(const std::string &, int)
+{
+    throw std::runtime_error("The sample server needs UNIX domain sockets, which this platform does not support");
+}
+
+void request_samples(const std::string &, const BatchOptions &)
+{
+    throw std::runtime_error("The sample server needs UNIX domain sockets, which this platform does not support");
+}
+
+#else
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+using std::string;
+
+namespace
+{
+
+/// Number of points generated with each call to Sampler::sampleRange()
+constexpr int64_t BLOCK_SIZE = 1 << 16;
+
+/// A configured sampler, kept alive between requests
+struct WarmSampler
+{
+    std::mutex               mutex; ///< samplers are stateful, so only one request can use one at a time
+    std::unique_ptr<Sampler> sampler;
+    int64_t                  num_points = 0;
+    uint64_t                 last_used  = 0;
+};
+
+/// The most recently used configured samplers, keyed by everything that affects their points
+class SamplerCache
+{
+public:
+    explicit SamplerCache(int capacity) : m_capacity(std::max(capacity, 1))
+    {
+    }
+
+    std::shared_ptr<WarmSampler> get(int index, const BatchOptions &o)
+    {
+        string key = fmt::format("{};{};{};{};{};{};{}", index, o.num_points, o.num_dimensions, o.seed, o.jitter,
+                                 o.strength, o.offset_type);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto                       &slot = m_entries[key];
+        if (!slot)
+            slot = std::make_shared<WarmSampler>();
+        auto entry       = slot;
+        entry->last_used = ++m_clock;
+
+        // evict the least recently used sampler; requests still using it keep it alive until they finish
+        if ((int)m_entries.size() > m_capacity)
+            m_entries.erase(std::min_element(m_entries.begin(), m_entries.end(), [](auto &a, auto &b)
+                                             { return a.second->last_used < b.second->last_used; }));
+        return entry;
+    }
+
+private:
+    std::mutex                                     m_mutex;
+    std::map<string, std::shared_ptr<WarmSampler>> m_entries;
+    uint64_t                                       m_clock = 0;
+    int                                            m_capacity;
+};
+
+string errno_message(const char *what)
+{
+    return fmt::format("{}: {}", what, strerror(errno));
+}
+
+BatchOptions parse_request(const string &line)
+{
+    BatchOptions options;
+    for (size_t begin = 0; begin < line.size();)
+    {
+        size_t end  = std::min(line.find(';', begin), line.size());
+        string pair = line.substr(begin, end - begin);
+        begin       = end + 1;
+        if (pair.empty())
+            continue;
+
+        size_t eq = pair.find('=');
+        if (eq == string::npos)
+            throw std::runtime_error(fmt::format("Expected key=value instead of \"{}\"", pair));
+        string key = pair.substr(0, eq), value = pair.substr(eq + 1);
+
+        if (key == "sampler")
+            options.sampler = value;
+        else if (key == "num-points")
+            options.num_points = std::stoll(value);
+        else if (key == "dimensions")
+            options.num_dimensions = std::stoi(value);
+        else if (key == "seed")
+            options.seed = (uint32_t)std::stoul(value);
+        else if (key == "jitter")
+            options.jitter = std::stof(value);
+        else if (key == "strength")
+            options.strength = std::stoi(value);
+        else if (key == "offset-type")
+            options.offset_type = value;
+        else if (key == "first")
+            options.first = std::stoll(value);
+        else if (key == "count")
+            options.count = std::stoll(value);
+        else
+            throw std::runtime_error(fmt::format("Unknown request key \"{}\"", key));
+    }
+    return options;
+}
+
+string format_request(const BatchOptions &o)
+{
+    return fmt::format("sampler={};num-points={};dimensions={};seed={};jitter={};strength={};offset-type={};first={};"
+                       "count={}\n",
+                       o.sampler, o.num_points, o.num_dimensions, o.seed, o.jitter, o.strength, o.offset_type,
+                       o.first, o.count);
+}
+
+/// Create an anonymous shared-memory segment of `size` bytes, and return its file descriptor
+int create_shared_memory(size_t size)
+{
+    // give the segment a unique name only long enough to open it, so that nothing is left behind if a process dies
+    static std::atomic<unsigned> counter{0};
+    string name = fmt::format("/samplinsafari-{}-{}", getpid(), counter++);
+    int    fd   = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0)
+        throw std::runtime_error(errno_message("Cannot create shared memory"));
+    shm_unlink(name.c_str());
+
+    if (ftruncate(fd, (off_t)size) != 0)
+    {
+        auto message = errno_message("Cannot allocate shared memory");
+        close(fd);
+        throw std::runtime_error(message);
+    }
+    return fd;
+}
+
+/// Send `reply`, along with the file descriptor `fd` unless it is negative
+void send_reply(int socket, const string &reply, int fd = -1)
+{
+    iovec  iov{(void *)reply.data(), reply.size()};
+    msghdr msg{};
+    msg.msg_iov    = &iov;
+    msg.msg_iovlen = 1;
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    if (fd >= 0)
+    {
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+        cmsghdr *cmsg      = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level   = SOL_SOCKET;
+        cmsg->cmsg_type    = SCM_RIGHTS;
+        cmsg->cmsg_len     = CMSG_LEN(sizeof(int));
+        memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+    }
+    if (sendmsg(socket, &msg, 0) < 0)
+        throw std::runtime_error(errno_message("Cannot send reply"));
+}
+
+/// Generate the points for one request into a new shared-memory segment, and send it back over `socket`
+void answer(int socket, const BatchOptions &options, SamplerCache &cache)
+{
+    int  index = find_sampler(options.sampler);
+    auto warm  = cache.get(index, options);
+
+    std::lock_guard<std::mutex> lock(warm->mutex);
+    if (!warm->sampler)
+    {
+        std::unique_ptr<Sampler> sampler(
+            create_sampler(index, options.num_dimensions ? options.num_dimensions : 3, 0.8f));
+        warm->num_points = configure_sampler(sampler.get(), options);
+        warm->sampler    = std::move(sampler);
+    }
+
+    Sampler *sampler = warm->sampler.get();
+    int64_t  first, count;
+    select_points(options, warm->num_points, first, count);
+    unsigned dims = sampler->dimensions();
+    size_t   size = sizeof(PointFileHeader) + size_t(count) * dims * sizeof(float);
+
+    int   fd   = create_shared_memory(size);
+    void *data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        auto message = errno_message("Cannot map shared memory");
+        close(fd);
+        throw std::runtime_error(message);
+    }
+
+    auto header = pointFileHeader(count, dims, PointFileHeader::Float32, sampler->name(), options.seed);
+    memcpy(data, header.data(), header.size());
+    float *points = (float *)((char *)data + sizeof(PointFileHeader));
+    std::fill(points, points + size_t(count) * dims, 0.5f);
+    for (int64_t i = 0; i < count; i += BLOCK_SIZE)
+        sampler->sampleRange(points + size_t(i) * dims, first + i, (unsigned)std::min(count - i, BLOCK_SIZE), dims);
+    munmap(data, size);
+
+    try
+    {
+        send_reply(socket, fmt::format("ok {} {}\n", count, dims), fd);
+    }
+    catch (...)
+    {
+        close(fd);
+        throw;
+    }
+    close(fd);
+}
+
+/// Answer the requests of one client until it disconnects
+void serve_client(int socket, std::shared_ptr<SamplerCache> cache)
+{
+    string buffer;
+    char   chunk[4096];
+    try
+    {
+        for (;;)
+        {
+            auto newline = buffer.find('\n');
+            if (newline == string::npos)
+            {
+                ssize_t n = read(socket, chunk, sizeof(chunk));
+                if (n < 0 && errno == EINTR)
+                    continue;
+                if (n <= 0)
+                    break;
+                buffer.append(chunk, n);
+                continue;
+            }
+
+            string line = buffer.substr(0, newline);
+            buffer.erase(0, newline + 1);
+            if (!line.empty() && line.back() == '\r')
+                line.pop_back();
+
+            string error;
+            try
+            {
+                answer(socket, parse_request(line), *cache);
+            }
+            catch (const std::exception &e)
+            {
+                error = e.what();
+            }
+            if (!error.empty())
+            {
+                std::replace(error.begin(), error.end(), '\n', ' ');
+                send_reply(socket, fmt::format("error {}\n", error));
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        // the client went away in the middle of a reply
+        fmt::print(stderr, "Dropping client: {}\n", e.what());
+    }
+    close(socket);
+}
+
+sockaddr_un socket_address(const string &path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path))
+        throw std::runtime_error(fmt::format("Invalid socket path \"{}\"", path));
+    memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+} // namespace
+
+void serve_samples(const string &socket_path, int cache_size)
+{
+    auto address = socket_address(socket_path);
+
+    // remove a socket left behind by an earlier server, but don't clobber anything else
+    struct stat st;
+    if (lstat(socket_path.c_str(), &st) == 0)
+    {
+        if (!S_ISSOCK(st.st_mode))
+            throw std::runtime_error(fmt::format("\"{}\" exists and is not a socket", socket_path));
+        unlink(socket_path.c_str());
+    }
+
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0)
+        throw std::runtime_error(errno_message("Cannot create socket"));
+    if (bind(listener, (const sockaddr *)&address, sizeof(address)) != 0 || listen(listener, 16) != 0)
+    {
+        auto message = errno_message(fmt::format("Cannot listen on \"{}\"", socket_path).c_str());
+        close(listener);
+        throw std::runtime_error(message);
+    }
+
+    // a client disconnecting early should only fail its own reply
+    signal(SIGPIPE, SIG_IGN);
+    fmt::print(stderr, "Serving samples on {}\n", socket_path);
+
+    // shared with the client threads, which are detached and may outlive this function if accept() fails
+    auto cache = std::make_shared<SamplerCache>(cache_size);
+    for (;;)
+    {
+        int client = accept(listener, nullptr, nullptr);
+        if (client < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            auto message = errno_message("Cannot accept connection");
+            close(listener);
+            throw std::runtime_error(message);
+        }
+        std::thread(serve_client, client, cache).detach();
+    }
+}
+
+void request_samples(const string &socket_path, const BatchOptions &options)
+{
+    if (options.fixed_point || options.double_precision)
+        throw std::runtime_error("The sample server only sends single-precision coordinates");
+
+    auto address = socket_address(socket_path);
+    int  socket  = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket < 0)
+        throw std::runtime_error(errno_message("Cannot create socket"));
+    std::unique_ptr<int, void (*)(int *)> socket_guard(&socket, [](int *s) { close(*s); });
+
+    if (connect(socket, (const sockaddr *)&address, sizeof(address)) != 0)
+        throw std::runtime_error(errno_message(fmt::format("Cannot connect to \"{}\"", socket_path).c_str()));
+
+    string request = format_request(options);
+    if (send(socket, request.data(), request.size(), 0) != (ssize_t)request.size())
+        throw std::runtime_error(errno_message("Cannot send request"));
+
+    // read the reply line, picking up the file descriptor sent along with it
+    string reply;
+    int    fd = -1;
+    while (reply.empty() || reply.back() != '\n')
+    {
+        char   chunk[256];
+        iovec  iov{chunk, sizeof(chunk)};
+        msghdr msg{};
+        msg.msg_iov    = &iov;
+        msg.msg_iovlen = 1;
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+        msg.msg_control    = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t n = recvmsg(socket, &msg, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            throw std::runtime_error("The server closed the connection without replying");
+        for (cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+            if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS)
+                memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+        reply.append(chunk, n);
+    }
+    reply.pop_back();
+
+    if (reply.compare(0, 3, "ok ") != 0 || fd < 0)
+    {
+        if (fd >= 0)
+            close(fd);
+        throw std::runtime_error(reply.compare(0, 6, "error ") == 0 ? reply.substr(6)
+                                                                    : fmt::format("Unexpected reply \"{}\"", reply));
+    }
+
+    struct stat st;
+    void       *data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        throw std::runtime_error(errno_message("Cannot map the shared memory from the server"));
+    std::unique_ptr<void, std::function<void(void *)>> mapping(data,
+                                                                [&st](void *p) { munmap(p, (size_t)st.st_size); });
+
+    PointFileInfo info;
+    if (!parsePointFileHeader(std::string_view((const char *)data, (size_t)st.st_size), info) ||
+        info.dtype != PointFileHeader::Float32 ||
+        info.dataOffset + info.numPoints * info.numDimensions * sizeof(float) > (uint64_t)st.st_size)
+        throw std::runtime_error("The server sent malformed points");
+
+    const float *points = (const float *)((const char *)data + info.dataOffset);
+    int          dims   = (int)info.numDimensions;
+    write_points(options, info.sampler, dims, (int64_t)info.numPoints,
+                 [&](Array2d<float> &block, int64_t i)
+                 {
+                     std::copy_n(points + size_t(i) * dims, size_t(block.sizeY()) * dims, &block(0, 0));
+                 });
+}
+
+#endif
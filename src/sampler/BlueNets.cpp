@@ -38,13 +38,13 @@ typedef std::string           String;
 const double dhex         = 1.07456993182354; // sqrt(2/sqrt(3)).
 static bool  interuptFlag = false;
 
-inline void shuffle(List &list)
+inline void shuffle(List &list, pcg32 &rng)
 { // Populate a randomly ordered list.
     uint32_t N = list.size();
     for (uint32_t i = 0; i < N; i++) list[i] = i;
     for (uint32_t i = N - 1; i > 0; i--)
     { // Iterate down the list, and swap each place with another place down, inclusive of same place.
-        uint32_t r = rand() % (i + 1); // (i + 1) means that the same place is included.
+        uint32_t r = rng.nextUInt(i + 1); // (i + 1) means that the same place is included.
         std::swap(list[i], list[r]);
     }
 }
@@ -68,6 +68,7 @@ public:
     double              conflictRadiusFactor;
     uint32_t            filterRange; // Range of Gaussian filter.
     int                 range;       // Neighborhood to consider in cluster optimization.
+    pcg32              &rng;         // Random number generator, seeded by the sampler so the result is repeatable.
     void                init();
     List                netSort();                   // Return a (0, 1)-sequence.
     uint32_t            p2q(uint32_t i, uint32_t k); // Retrieve the stratum of point i in the k'th stratification
@@ -87,7 +88,7 @@ public:
     int optimize(int i); // Make all permissible swaps to optimize relative to a given point index, using the designated
                          // energy function, and return the number of applied swaps.
 public:
-    Net(int pointCount, String path = ""); // Create an N-points binary net, where N is a power of 2.
+    Net(int pointCount, pcg32 &rng, String path = ""); // Create an N-points binary net, N a power of 2.
     void   setSigma(double v);
     void   setRf(double v);
     void   setRange(int v);  // Set neighborhood for cluster optimization; default is n2/2.
@@ -95,7 +96,7 @@ public:
     void   optimize(std::string seq, int iterations);
 };
 
-Net::Net(int pointCount, String path)
+Net::Net(int pointCount, pcg32 &rng, String path) : rng(rng)
 {
     outputPath = path;
     m          = ceil(std::log2(pointCount)); // Round up to a power of 2.
@@ -161,8 +162,9 @@ List Net::netSort()
                 slotNo - relevantBits +
                 (relevantBits >> 1); // Perform a bit rotate over the relevant bits; the least significant being 0;
             uint32_t newSlot1 = newSlot0 + (span >> 1); // This is the partial bit rotate for slotNo + 1
-            uint32_t toggle   = rand() & 1; // Randomly decide which slot maps to which. I tried extracting bits from a
-                                            // single random number, but it exhibited some correlation.
+            // Randomly decide which slot maps to which. I tried extracting bits from a single random number, but it
+            // exhibited some correlation.
+            uint32_t toggle   = rng.nextUInt() & 1;
             tmpList[newSlot0] = list[slotNo ^ toggle];
             tmpList[newSlot1] = list[(slotNo + 1) ^ toggle];
         }
@@ -350,7 +352,7 @@ void Net::optimize(std::string seq, int iterations)
             case 'F': energyFunction = &Net::minConflict; break;
             default: fprintf(stderr, "Error: Unknown optimization option."); exit(1);
             }
-            shuffle(order);
+            shuffle(order, rng);
             int swapCount(0);
             for (int i = 0; i < N && !interuptFlag; i++) { swapCount += optimize(order[i]); }
             fprintf(stderr, "  Performed %4d '%c' swaps. Current conflict radius is %0.5f\n", swapCount, seq[k],
@@ -378,7 +380,8 @@ void BlueNets::regenerate()
     xs.resize(pointCount);
     ys.resize(pointCount);
 
-    Net net(pointCount);
+    m_rand.seed(m_seed);
+    Net net(pointCount, m_rand);
     net.setSigma(sigma);
     net.setRf(rf);
     net.setRange(range);
@@ -411,9 +414,16 @@ int BlueNets::setNumSamples(unsigned num)
     return pointCount;
 }
 
+int BlueNets::roundNumSamples(unsigned num) const { return roundUpPow2(num); }
+
 void BlueNets::sample(float r[], unsigned i)
 {
     assert(i < pointCount);
     r[0] = xs[i];
     r[1] = ys[i];
+}
+
+void BlueNets::sampleRange(float points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeInline(*this, points, first, count, stride);
 }
\ No newline at end of file
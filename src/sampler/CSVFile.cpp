@@ -2,12 +2,27 @@
     \author Wojciech Jarosz
 */
 
+#include <algorithm>
 #include <assert.h>
+#include <cctype>
+#include <charconv>
+#include <condition_variable>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <sampler/CSVFile.h>
+#include <sampler/MappedFile.h>
+#include <sampler/PointFile.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
 
 namespace fs = std::filesystem;
 using std::string;
@@ -17,196 +32,427 @@ using std::vector;
 namespace
 {
 
-// from https://stackoverflow.com/a/116220 (CC BY-SA 4.0)
-string read_file_to_string(string_view path)
-{
-    constexpr auto read_size = std::size_t(4096);
-    auto           stream    = std::ifstream(path.data());
-    stream.exceptions(std::ios_base::badbit);
-
-    if (!stream)
-        throw std::ios_base::failure("file does not exist");
+// Files smaller than this are always parsed on the calling thread
+constexpr size_t min_parallel_chunk_size = size_t(1) << 20;
 
-    auto out = std::string();
-    auto buf = std::string(read_size, '\0');
-    while (stream.read(&buf[0], read_size))
-        out.append(buf, 0, stream.gcount());
-    out.append(buf, 0, stream.gcount());
-    return out;
+/// Parse one floating-point value from [first, last), skipping leading whitespace. Unparsable values are set to zero.
+void parse_float(const char *first, const char *last, float &value)
+{
+    while (first < last && (*first == ' ' || *first == '\t')) ++first;
+    if (first < last && *first == '+')
+        ++first;
+
+#if defined(__cpp_lib_to_chars)
+    if (std::from_chars(first, last, value).ec != std::errc())
+        value = 0.f;
+#else
+    // strtof needs a null-terminated string, and the mapped file is not
+    char buffer[64];
+    auto length = std::min(size_t(last - first), sizeof(buffer) - 1);
+    memcpy(buffer, first, length);
+    buffer[length] = '\0';
+    value          = strtof(buffer, nullptr);
+#endif
 }
 
-// -------------------------------------
-// The below functions are adapted from:
-// -------------------------------------
-// Dear ImGui Test Engine License (v1.03)
-// Copyright (c) 2018-2023 Omar Cornut
-
-// This document is a legal agreement ("License") between you ("Licensee") and
-// DISCO HELLO ("Licensor") that governs your use of Dear ImGui Test Engine ("Software").
-
-// 1. LICENSE MODELS
+/// Return the first line break in [p, end), or nullptr. Lines may end in "\n", "\r\n", or (classic Mac) a bare "\r".
+const char *find_line_break(const char *p, const char *end)
+{
+    // search growing windows, so a file without any '\n' does not make every line scan the rest of the file
+    for (size_t window = 256; p < end; p += window, window *= 2)
+    {
+        const char *stop = p + std::min(window, size_t(end - p));
+        const char *lf   = (const char *)memchr(p, '\n', stop - p);
+        if (const char *cr = (const char *)memchr(p, '\r', (lf ? lf : stop) - p))
+            return cr;
+        if (lf)
+            return lf;
+    }
+    return nullptr;
+}
 
-// 1.1. Free license
+/// Return the number of comma-separated columns on the first non-empty line of `data`.
+unsigned count_columns(string_view data)
+{
+    const char *p = data.data(), *end = p + data.size();
+    while (p < end && (*p == '\n' || *p == '\r')) ++p;
 
-// The Licensor grants you a free license ("Free License") if you meet ANY of the following
-// criterion:
+    if (p == end)
+        return 0;
 
-// - You are a natural person;
-// - You are not a legal entity, or you are a not-for-profit legal entity;
-// - You are using this Software for educational purposes;
-// - You are using this Software to create Derivative Software released publicly and under
-//   an Open Source license, as defined by the Open Source Initiative;
-// - You are a legal entity with a turnover inferior to 2 million USD (or equivalent) during
-//   your last fiscal year.
+    const char *eol     = find_line_break(p, end);
+    unsigned    columns = 1;
+    for (; p < (eol ? eol : end); ++p) columns += *p == ',';
+    return columns;
+}
 
-// 1.2. Paid license
+/// Return the end of the line starting at `p` (without its line break), and store the start of the next line in `next`
+const char *line_end(const char *p, const char *end, const char *&next)
+{
+    const char *eol = find_line_break(p, end);
+    if (!eol)
+        return next = end;
 
-// If you do not meet any criterion of Article 1.1, Licensor grants you a trial period of a
-// maximum of 45 days, at no charge. Following this trial period, you must subscribe to a paid
-// license ("Paid License") with the Licensor to continue using the Software.
-// Paid Licenses are exclusively sold by DISCO HELLO. Paid Licenses and the associated
-// information are available at the following URL: http://www.dearimgui.com/licenses
+    next = eol + (*eol == '\r' && eol + 1 < end && eol[1] == '\n' ? 2 : 1);
+    return eol;
+}
 
-// 2. GRANT OF LICENSE
+/// Whether the line [p, e) is a non-empty row with exactly `columns` comma-separated values
+bool is_row(const char *p, const char *e, unsigned columns)
+{
+    return e > p && unsigned(std::count(p, e, ',')) + 1 == columns;
+}
 
-// 2.1. License scope
+/// One line-aligned chunk of a CSV file, and where its rows go
+struct CSVChunk
+{
+    string_view    text;
+    size_t         rows  = 0;       ///< number of valid rows in this chunk
+    size_t         lines = 0;       ///< number of lines (including skipped ones) in this chunk
+    vector<size_t> bad_lines;       ///< chunk-relative indices of lines with the wrong number of columns
+    float         *out   = nullptr; ///< where parse_chunk() writes the values of the valid rows
+};
 
-// A limited and non-exclusive license is hereby granted, to the Licensee, to reproduce,
-// execute, publicly perform, and display, use, copy, modify, merge, distribute, or create
-// derivative works based on and/or derived from the Software ("Derivative Software").
+/// Count the lines and valid rows in `chunk.text`, recording the lines with an unexpected number of columns
+void scan_chunk(CSVChunk &chunk, unsigned columns)
+{
+    const char *p = chunk.text.data(), *end = p + chunk.text.size();
+    while (p < end)
+    {
+        const char *next, *eol = line_end(p, end, next);
+        if (is_row(p, eol, columns))
+            ++chunk.rows;
+        else if (eol > p)
+            chunk.bad_lines.push_back(chunk.lines);
+
+        ++chunk.lines;
+        p = next;
+    }
+}
 
-// 2.2. Right of distribution
+/// Parse the valid rows of `chunk.text`, as found by scan_chunk(), into `chunk.out`.
+/**
+    Empty lines and the recorded bad lines are skipped. Delimiters are found with memchr, which the C library implements
+    with SIMD instructions.
+*/
+void parse_chunk(CSVChunk &chunk, unsigned columns)
+{
+    const char *p = chunk.text.data(), *end = p + chunk.text.size();
+    float      *out = chunk.out;
+    auto        bad = chunk.bad_lines.begin();
 
-// License holders may also publish and/or distribute the Software or any Derivative
-// Software. The above copyright notice and this license shall be included in all copies
-// or substantial portions of the Software and/or Derivative Software.
+    for (size_t line = 0; p < end; ++line)
+    {
+        const char *next, *eol = line_end(p, end, next);
 
-// License holders may add their own attribution notices within the Derivative Software
-// that they distribute. Such attribution notices must not directly or indirectly imply a
-// modification of the License. License holders may provide to their modifications their
-// own copyright and/or additional or different terms and conditions, providing such
-// conditions complies with this License.
+        if (bad != chunk.bad_lines.end() && *bad == line)
+            ++bad;
+        else if (eol > p)
+        {
+            // the row has exactly `columns` fields, so the last one ends at the line break
+            for (unsigned col = 1; col < columns; ++col)
+            {
+                const char *comma = (const char *)memchr(p, ',', eol - p);
+                parse_float(p, comma, *out++);
+                p = comma + 1;
+            }
+            parse_float(p, eol, *out++);
+        }
 
-// 3. DISCLAIMER
+        p = next;
+    }
+}
 
-// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
-// INCLUDING BUT NOT LIMITED TO THE FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
-// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES
-// OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
-// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+/// Split `data` into `n` chunks of roughly equal size, each ending at a line boundary
+vector<CSVChunk> split_lines(string_view data, size_t n)
+{
+    vector<CSVChunk> chunks;
+    const char      *begin = data.data(), *end = begin + data.size(), *p = begin;
+    for (size_t k = 1; k <= n && p < end; ++k)
+    {
+        const char *q = k == n ? end : std::max(p, begin + data.size() * k / n);
+        if (q < end)
+            line_end(q, end, q);
+        chunks.emplace_back().text = string_view(p, q - p);
+        p = q;
+    }
+    return chunks;
+}
 
-//-----------------------------------------------------------------------------
-// Helper: Simple/dumb CSV parser
-//-----------------------------------------------------------------------------
+/**
+    Parse the rows of the CSV `data`, each with `columns` values, and append them to `values`. Large inputs are split
+    into line-aligned chunks that are parsed in parallel.
 
-struct CSVParser
+    \param first_line  Number of lines preceding `data` in the file, used when reporting malformed lines
+    \returns           The number of lines in `data`
+*/
+size_t parse_rows(const string &filename, string_view data, unsigned columns, vector<float> &values,
+                  size_t first_line = 0)
 {
-    // Public fields
-    int Columns = 0; // Number of columns in CSV file.
-    int Rows    = 0; // Number of rows in CSV file.
+    if (columns == 0)
+        return 0;
 
-    // Internal fields
-    string               _Filename; // The filename this was loaded from
-    vector<char>         _Data;     // CSV file data.
-    vector<const char *> _Index;    // CSV table: _Index[row * _Columns + col].
+    size_t num_chunks = 1;
+#ifndef __EMSCRIPTEN__
+    num_chunks = std::clamp<size_t>(data.size() / min_parallel_chunk_size, 1, std::thread::hardware_concurrency());
+#endif
 
-    // Functions
-    CSVParser(int columns = -1) : Columns(columns)
+    // count the rows of each chunk first, so that they can all be parsed straight into their place in `values`
+    auto chunks         = split_lines(data, num_chunks);
+    auto for_each_chunk = [&chunks, columns](void (*fn)(CSVChunk &, unsigned))
     {
-    }
-    ~CSVParser()
+        if (chunks.size() == 1)
+            return fn(chunks[0], columns);
+
+        vector<std::thread> threads;
+        for (auto &chunk : chunks) threads.emplace_back(fn, std::ref(chunk), columns);
+        for (auto &t : threads) t.join();
+    };
+    for_each_chunk(scan_chunk);
+
+    // report malformed lines (1-based, counting from the start of the file), and find each chunk's slice of `values`
+    size_t total = 0, line_offset = first_line;
+    for (auto &chunk : chunks)
     {
-        clear();
+        for (auto l : chunk.bad_lines)
+            fprintf(stderr, "%s: Unexpected number of columns on line %zu, ignoring.\n", filename.c_str(),
+                    line_offset + l + 1);
+        line_offset += chunk.lines;
+        total += chunk.rows * columns;
     }
-    bool        load_from(const string &filename, string_view _Data); // parse CSV file stored in the string_view
-    void        clear();                                              // Free allocated buffers.
-    const char *cell(int row, int col)
+
+    values.resize(values.size() + total);
+    float *out = values.data() + values.size() - total;
+    for (auto &chunk : chunks)
     {
-        assert(0 <= row && row < Rows && 0 <= col && col < Columns);
-        return _Index[row * Columns + col];
+        chunk.out = out;
+        out += chunk.rows * columns;
     }
-};
+    for_each_chunk(parse_chunk);
 
-void CSVParser::clear()
+    return line_offset - first_line;
+}
+
+/// Read the CSV file `filename` into `values` (reusing its capacity), returning false if it contains no rows
+bool read_frame(const string &filename, vector<float> &values, unsigned &columns)
 {
-    Rows = Columns = 0;
-    _Filename      = "";
-    _Data.clear();
-    _Index.clear();
+    MappedFile file(filename);
+    columns = count_columns(file.view());
+    values.clear();
+    parse_rows(filename, file.view(), columns, values);
+    return !values.empty();
 }
 
-bool CSVParser::load_from(const string &filename, string_view csv_data)
+/// Whether `name` matches the wildcard `pattern`, where '*' matches any sequence of characters and '?' any character
+bool wildcard_match(const char *pattern, const char *name)
 {
-    _Filename = filename;
-    _Data     = vector<char>{csv_data.begin(), csv_data.end()};
-    // pad with one extra zero
-    _Data.push_back('\0');
+    if (*pattern == '*')
+        return wildcard_match(pattern + 1, name) || (*name && wildcard_match(pattern, name + 1));
+    if (!*pattern || !*name)
+        return !*pattern && !*name;
+    return (*pattern == '?' || *pattern == *name) && wildcard_match(pattern + 1, name + 1);
+}
 
-    int columns = 1;
-    if (Columns > 0)
+/// Order strings so that embedded numbers compare by value, i.e. "frame_2" < "frame_10"
+bool natural_less(const string &a, const string &b)
+{
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < b.size())
     {
-        columns = Columns; // User-provided expected column count.
+        if (isdigit((unsigned char)a[i]) && isdigit((unsigned char)b[j]))
+        {
+            size_t ie = a.find_first_not_of("0123456789", i), je = b.find_first_not_of("0123456789", j);
+            ie = std::min(ie, a.size());
+            je = std::min(je, b.size());
+            // compare by length of the number without leading zeros first, then digit by digit
+            size_t ia = std::min(a.find_first_not_of('0', i), ie), jb = std::min(b.find_first_not_of('0', j), je);
+            if (ie - ia != je - jb)
+                return ie - ia < je - jb;
+            if (int c = a.compare(ia, ie - ia, b, jb, je - jb))
+                return c < 0;
+            i = ie;
+            j = je;
+        }
+        else if (a[i] != b[j])
+            return a[i] < b[j];
+        else
+            ++i, ++j;
     }
-    else
+    return a.size() - i < b.size() - j;
+}
+
+/// Expand a printf pattern ("frame_%04d.csv") or glob ("frame_*.csv") into the list of existing files it refers to
+vector<string> expand_pattern(const string &pattern)
+{
+    vector<string> files;
+    if (pattern.find('%') != string::npos)
     {
-        for (const char *c = _Data.data(); *c != '\n' && *c != '\0';
-             c++) // Count columns. Quoted columns with commas are not supported.
-            if (*c == ',')
-                columns++;
+        // frames are numbered consecutively, starting at either 0 or 1
+        vector<char> buffer(pattern.size() + 32);
+        for (int i = 0;; ++i)
+        {
+            snprintf(buffer.data(), buffer.size(), pattern.c_str(), i);
+            if (fs::exists(buffer.data()))
+                files.emplace_back(buffer.data());
+            else if (i > 0 || !files.empty())
+                break;
+        }
+    }
+    else if (pattern.find_first_of("*?") != string::npos)
+    {
+        // only the file name may contain wildcards
+        fs::path        path{pattern};
+        fs::path        dir      = path.has_parent_path() ? path.parent_path() : fs::path{"."};
+        string          wildcard = path.filename().string();
+        std::error_code ec;
+        for (auto &entry : fs::directory_iterator(dir, ec))
+            if (entry.is_regular_file(ec) && wildcard_match(wildcard.c_str(), entry.path().filename().string().c_str()))
+                files.push_back(entry.path().string());
+        std::sort(files.begin(), files.end(), natural_less);
     }
+    else if (fs::exists(pattern))
+        files.push_back(pattern);
 
-    // Count rows. Extra new lines anywhere in the file are ignored.
-    int max_rows = 0;
-    for (const char *c = _Data.data(), *end = c + _Data.size() - 1; c < end; c++)
-        if ((*c == '\n' && c[1] != '\r' && c[1] != '\n') || *c == '\0')
-            max_rows++;
+    return files;
+}
 
-    if (columns == 0 || max_rows == 0)
-        return false;
+} // namespace
+
+/// Parses upcoming frames of a sequence on a background thread into a ring of reusable buffers.
+struct CSVFile::FramePrefetcher
+{
+    struct Slot
+    {
+        int           frame = -1; ///< the frame stored (or being parsed) in this slot, or -1 if the slot is free
+        bool          ready = false;
+        bool          ok    = false;
+        vector<float> values;
+        unsigned      columns = 0;
+    };
+
+    /// Start prefetching the frames following `taken`, the frame already handed over (if any), in direction `step`
+    FramePrefetcher(const vector<string> &files, unsigned depth, int taken = -1, int step = 1) :
+        files(files), slots(depth + 1), current(std::max(taken, 0)), step(step), taken(taken)
+    {
+#ifndef __EMSCRIPTEN__
+        worker = std::thread(&FramePrefetcher::run, this);
+#endif
+    }
 
-    // Create index
-    _Index.resize(columns * max_rows);
+    ~FramePrefetcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv.notify_all();
+        if (worker.joinable())
+            worker.join();
+    }
+
+    /// The frames that should be resident after a request for `current`, in order of priority
+    vector<int> wanted() const
+    {
+        vector<int> frames;
+        for (int k = current == taken ? 1 : 0; k < (int)slots.size(); ++k)
+        {
+            int f = current + k * step;
+            if (f < 0 || f >= (int)files.size())
+                break;
+            frames.push_back(f);
+        }
+        return frames;
+    }
 
-    int         col      = 0;
-    const char *col_data = _Data.data();
-    for (char *c = _Data.data(); *c != '\0'; c++)
+    void run()
     {
-        const bool is_comma = (*c == ',');
-        const bool is_eol   = (*c == '\n' || *c == '\r');
-        const bool is_eof   = (*c == '\0');
-        if (is_comma || is_eol || is_eof)
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stop)
         {
-            _Index[Rows * columns + col] = col_data;
-            col_data                     = c + 1;
-            if (is_comma)
+            // find the most urgent frame that isn't resident yet, and a slot that isn't needed to parse it into
+            auto  frames = wanted();
+            Slot *target = nullptr;
+            int   frame  = -1;
+            for (int f : frames)
+                if (std::none_of(slots.begin(), slots.end(), [f](const Slot &s) { return s.frame == f; }))
+                {
+                    frame = f;
+                    break;
+                }
+            if (frame >= 0)
+                for (auto &slot : slots)
+                    if ((slot.ready || slot.frame < 0) &&
+                        std::find(frames.begin(), frames.end(), slot.frame) == frames.end())
+                    {
+                        target = &slot;
+                        break;
+                    }
+
+            if (!target)
+            {
+                cv.wait(lock);
+                continue;
+            }
+
+            target->frame = frame;
+            target->ready = false;
+            lock.unlock();
+            bool ok = false;
+            try
             {
-                col++;
+                ok = read_frame(files[frame], target->values, target->columns);
             }
-            else
+            catch (const std::exception &e)
             {
-                if (col + 1 == columns)
-                    Rows++;
-                else
-                    fprintf(stderr, "%s: Unexpected number of columns on line %d, ignoring.\n", _Filename.c_str(),
-                            Rows + 1); // FIXME
-                col = 0;
+                std::cerr << "Error reading file: " << files[frame] << ": " << e.what() << std::endl;
             }
-            *c = 0;
-            if (is_eol)
-                while (c[1] == '\r' || c[1] == '\n')
-                    c++;
+            lock.lock();
+            target->ok    = ok;
+            target->ready = true;
+            cv.notify_all();
         }
     }
 
-    Columns = columns;
-    return true;
-}
+    /// Swap the parsed contents of `frame` into `values` (waiting for it if necessary) and prefetch the following ones
+    bool take(int frame, vector<float> &values, unsigned &columns)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        step    = frame < current ? -1 : 1;
+        current = frame;
+        cv.notify_all();
 
-// -------------------------------------
-// end Dear ImGui Test Engine code
-// -------------------------------------
+        auto has_frame = [this, frame]
+        { return std::any_of(slots.begin(), slots.end(), [frame](const Slot &s) { return s.frame == frame && s.ready; }); };
 
-} // namespace
+        if (worker.joinable())
+            cv.wait(lock, has_frame);
+        else if (!has_frame())
+        {
+            // without threads, parse the frame right away into the least useful slot
+            auto &slot = slots[frame % slots.size()];
+            slot.frame = frame;
+            slot.ok    = read_frame(files[frame], slot.values, slot.columns);
+            slot.ready = true;
+        }
+
+        auto &slot = *std::find_if(slots.begin(), slots.end(), [frame](const Slot &s) { return s.frame == frame; });
+        // the previously displayed points' buffer goes back into the ring to be reused
+        std::swap(slot.values, values);
+        columns    = slot.columns;
+        slot.frame = -1;
+        taken      = frame;
+        cv.notify_all();
+        return slot.ok;
+    }
+
+    vector<string>          files;
+    vector<Slot>            slots;
+    int                     current = 0, step = 1, taken = -1;
+    bool                    stop = false;
+    std::mutex              mutex;
+    std::condition_variable cv;
+    std::thread             worker;
+};
 
 CSVFile::CSVFile(const string &filename)
 {
@@ -219,31 +465,405 @@ CSVFile::CSVFile(const string &filename)
 
 bool CSVFile::read(const string &filename, const string_view &csv_data)
 {
-    m_filename = filename;
+    m_frames.clear();
+    m_prefetcher.reset();
+
+    bool new_file = filename != m_filename;
+    m_filename    = filename;
+    if (new_file)
+        watch();
+
+    // map the file into memory unless the caller already provided its contents
+    MappedFile  file;
+    string_view data = csv_data;
+    if (data.empty())
+    {
+        file.open(filename);
+        data = file.view();
+    }
 
-    CSVParser parser;
-    if (!parser.load_from(filename, csv_data.empty() ? read_file_to_string(filename) : csv_data))
+    m_appendable  = false;
+    m_parsedBytes = data.size();
+
+    PointFileInfo info;
+    if (parsePointFileHeader(data, info))
+        return readBinary(std::move(file), data, info);
+
+    if (m_streaming && csv_data.empty())
+    {
+        m_numSamples  = 0;
+        m_windowStart = m_windowRows = 0;
+        m_rowIndex.clear();
+        m_file = std::move(file);
+        indexRows();
+        if (m_numSamples == 0)
+            return false;
+
+        loadWindow(0, m_windowSize);
+        return true;
+    }
+
+    // while watching, the last line may still be in the middle of being written
+    if (m_watching && csv_data.empty())
+        data = data.substr(0, data.find_last_of("\r\n") + 1);
+
+    vector<float> values;
+    unsigned      columns = count_columns(data);
+    size_t        lines   = parse_rows(filename, data, columns, values);
+    if (values.empty())
         return false;
 
-    m_numDimensions = parser.Columns;
-    m_numSamples    = parser.Rows;
+    m_values        = std::move(values);
+    m_rows          = m_values.data();
+    m_numDimensions = columns;
+    m_numSamples    = unsigned(m_values.size() / columns);
+    m_windowStart   = 0;
+    m_windowRows    = m_numSamples;
+    m_file.close();
+    m_rowIndex.clear();
 
-    m_values.resize(m_numDimensions * m_numSamples);
+    m_appendable  = csv_data.empty();
+    m_parsedBytes = data.size();
+    m_parsedLines = lines;
 
-    // Read point data from CSV
-    int i = 0;
-    for (int row = 0; row < parser.Rows; ++row)
+    return true;
+}
+
+bool CSVFile::readBinary(MappedFile &&file, string_view data, const PointFileInfo &info)
+{
+    uint64_t count = info.numPoints * info.numDimensions;
+    if (info.numPoints > std::numeric_limits<unsigned>::max() || info.numDimensions == 0 ||
+        (data.size() - info.dataOffset) / PointFileHeader::valueSize(info.dtype) < count)
+        throw std::runtime_error("\"" + m_filename + "\" is truncated or stores too many points");
+
+    m_numDimensions = info.numDimensions;
+    m_numSamples    = unsigned(info.numPoints);
+    m_windowStart   = 0;
+    m_windowRows    = m_numSamples;
+    m_rowIndex.clear();
+
+    const char *values = data.data() + info.dataOffset;
+
+    // float data in a file we mapped ourselves is used in place; the OS pages it in as rows are accessed
+    const uint16_t one           = 1;
+    const bool     little_endian = *(const uint8_t *)&one == 1;
+    if (file.is_open() && info.dtype == PointFileHeader::Float32 && little_endian &&
+        uintptr_t(values) % alignof(float) == 0)
     {
-        for (int col = 0; col < parser.Columns; ++col, ++i)
+        m_values = vector<float>();
+        m_file   = std::move(file);
+        m_rows   = (const float *)values;
+        return true;
+    }
+
+    // otherwise convert to native floats
+    size_t size = PointFileHeader::valueSize(info.dtype);
+    m_values.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t v = 0;
+        for (size_t b = 0; b < size; ++b) v |= uint64_t((uint8_t)values[size * i + b]) << (8 * b);
+
+        if (info.dtype == PointFileHeader::UInt32)
+            m_values[i] = float(v * 0x1p-32);
+        else if (info.dtype == PointFileHeader::Float64)
         {
-            assert(i < (int)m_values.size());
-            sscanf(parser.cell(row, col), "%f", &m_values[i]);
+            double d;
+            memcpy(&d, &v, sizeof(double));
+            m_values[i] = float(d);
+        }
+        else
+        {
+            uint32_t f = uint32_t(v);
+            memcpy(&m_values[i], &f, sizeof(float));
         }
     }
-
+    m_rows = m_values.data();
+    m_file.close();
     return true;
 }
 
+CSVFile::~CSVFile()
+{
+    m_watching = false;
+    watch();
+}
+
+void CSVFile::setWatching(bool watching)
+{
+    if (watching == m_watching)
+        return;
+
+    m_watching = watching;
+
+    // re-read the file so that a partially written last line is left for update() to parse once it is complete
+    if (m_watching && m_frames.empty() && !m_filename.empty() && fs::exists(m_filename))
+        read(m_filename);
+
+    watch();
+}
+
+void CSVFile::watch()
+{
+#if defined(__linux__)
+    if (m_watchHandle >= 0)
+        ::close(m_watchHandle);
+    m_watchHandle = -1;
+
+    if (m_watching && !m_filename.empty())
+    {
+        // on Linux, inotify tells us when the file changes so update() doesn't need to stat it every frame
+        m_watchHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_watchHandle >= 0 && inotify_add_watch(m_watchHandle, m_filename.c_str(),
+                                                    IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF |
+                                                        IN_MOVE_SELF) < 0)
+        {
+            ::close(m_watchHandle);
+            m_watchHandle = -1;
+        }
+    }
+#endif
+}
+
+int CSVFile::update()
+{
+    if (!m_watching || !m_frames.empty() || m_filename.empty())
+        return -1;
+
+#if defined(__linux__)
+    bool replaced = false;
+    if (m_watchHandle >= 0)
+    {
+        // drain all pending events; there is nothing to do if none arrived
+        alignas(inotify_event) char events[4096];
+        bool                        changed = false;
+        for (ssize_t length; (length = ::read(m_watchHandle, events, sizeof(events))) > 0;)
+            for (char *e = events; e < events + length; e += sizeof(inotify_event) + ((inotify_event *)e)->len)
+            {
+                changed = true;
+                replaced |= (((inotify_event *)e)->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED)) != 0;
+            }
+        if (!changed)
+            return -1;
+    }
+#else
+    const bool replaced = false;
+#endif
+
+    std::error_code ec;
+    uint64_t        size = fs::file_size(m_filename, ec);
+    if (ec || (size == m_parsedBytes && !replaced))
+        return -1;
+
+    auto reread = [this]
+    {
+        bool ok = read(m_filename);
+        // the file may have been replaced by a new one, so watch that instead
+        watch();
+        return ok ? 0 : -1;
+    };
+
+    // anything other than rows appended to an in-memory CSV file requires reading the whole file again
+    if (!m_appendable || replaced || size < m_parsedBytes || m_numSamples == 0)
+        return reread();
+
+    // parse only the complete lines that were appended since the last update
+    MappedFile file(m_filename);
+    // the file may have been truncated since its size was checked above
+    if (file.view().size() < m_parsedBytes)
+        return reread();
+
+    string_view data = file.view().substr(m_parsedBytes);
+    // a "\r\n" may have been split between two appends; its '\n' ends a line that was already counted
+    if (m_parsedBytes > 0 && file.view()[m_parsedBytes - 1] == '\r' && !data.empty() && data[0] == '\n')
+    {
+        data.remove_prefix(1);
+        ++m_parsedBytes;
+    }
+    data = data.substr(0, data.find_last_of("\r\n") + 1);
+    if (data.empty())
+        return -1;
+
+    m_parsedLines += parse_rows(m_filename, data, m_numDimensions, m_values, m_parsedLines);
+    m_parsedBytes += data.size();
+
+    unsigned first = m_numSamples;
+    m_rows         = m_values.data();
+    m_numSamples = m_windowRows = unsigned(m_values.size() / m_numDimensions);
+    return m_numSamples > first ? int(first) : -1;
+}
+
+bool CSVFile::readSequence(const string &pattern)
+{
+    auto frames = expand_pattern(pattern);
+    if (frames.empty())
+        throw std::runtime_error("No files match \"" + pattern + "\"");
+
+    m_frames = std::move(frames);
+    m_prefetcher.reset(new FramePrefetcher(m_frames, m_prefetchFrames));
+    m_frame = 0;
+    return loadFrame(0);
+}
+
+bool CSVFile::setFrame(unsigned frame)
+{
+    if (m_frames.empty() || frame >= m_frames.size())
+        return false;
+
+    // the current frame has already been handed over by the prefetcher
+    if (frame == m_frame)
+        return m_numSamples > 0;
+
+    return loadFrame(frame);
+}
+
+void CSVFile::setPrefetchFrames(unsigned frames)
+{
+    m_prefetchFrames = std::max(frames, 1u);
+    // carry on prefetching from the current frame, in the direction the sequence is being played
+    if (m_prefetcher)
+        m_prefetcher.reset(new FramePrefetcher(m_frames, m_prefetchFrames, int(m_frame), m_prefetcher->step));
+}
+
+bool CSVFile::loadFrame(unsigned frame)
+{
+    unsigned columns = 0;
+    m_frame          = frame;
+    m_filename       = m_frames[frame];
+    if (!m_prefetcher->take(int(frame), m_values, columns))
+    {
+        m_values.clear();
+        columns = 0;
+    }
+
+    m_rows          = m_values.data();
+    m_numDimensions = columns;
+    m_numSamples    = columns ? unsigned(m_values.size() / columns) : 0;
+    m_windowStart   = 0;
+    m_windowRows    = m_numSamples;
+    m_appendable    = false;
+    m_file.close();
+    m_rowIndex.clear();
+    return m_numSamples > 0;
+}
+
+void CSVFile::setStreaming(bool streaming)
+{
+    if (streaming == m_streaming)
+        return;
+
+    m_streaming = streaming;
+
+    // reload the current file in the new mode (files provided as in-memory data, and sequences, cannot be streamed)
+    if (m_frames.empty() && !m_filename.empty() && fs::exists(m_filename))
+        read(m_filename);
+}
+
+void CSVFile::setWindowSize(unsigned rows)
+{
+    m_windowSize = std::max(rows, ROW_INDEX_STRIDE);
+    if (m_streaming && m_windowRows > m_windowSize)
+        loadWindow(m_windowStart, m_windowSize);
+}
+
+void CSVFile::indexRows()
+{
+    string_view data = m_file.view();
+
+    m_numDimensions = count_columns(data);
+    m_numSamples    = 0;
+    if (m_numDimensions == 0)
+        return;
+
+    // record the byte offset of every ROW_INDEX_STRIDE-th valid row, skipping malformed lines like parse_rows does
+    const char *begin = data.data(), *end = begin + data.size(), *p = begin;
+    for (size_t line = 1; p < end; ++line)
+    {
+        const char *next, *eol = line_end(p, end, next);
+        if (is_row(p, eol, m_numDimensions))
+        {
+            if (m_numSamples % ROW_INDEX_STRIDE == 0)
+                m_rowIndex.push_back(uint64_t(p - begin));
+            ++m_numSamples;
+        }
+        else if (eol > p)
+            fprintf(stderr, "%s: Unexpected number of columns on line %zu, ignoring.\n", m_filename.c_str(), line);
+        p = next;
+    }
+}
+
+void CSVFile::loadWindow(unsigned first, unsigned count)
+{
+    first = std::min(first, m_numSamples);
+    count = std::min({count, m_windowSize, m_numSamples - first});
+
+    // jump to the closest indexed row, then skip forward to the first requested row
+    const char *begin = m_file.data(), *end = begin + m_file.size();
+    const char *p     = begin + (first < m_numSamples ? m_rowIndex[first / ROW_INDEX_STRIDE] : m_file.size());
+    auto        skip  = [this, end](const char *p, unsigned rows)
+    {
+        const char *next;
+        for (; rows && p < end; p = next)
+            if (is_row(p, line_end(p, end, next), m_numDimensions))
+                --rows;
+        return p;
+    };
+    p = skip(p, first % ROW_INDEX_STRIDE);
+
+    CSVChunk chunk;
+    chunk.text = string_view(p, skip(p, count) - p);
+    scan_chunk(chunk, m_numDimensions);
+    m_values.resize(chunk.rows * m_numDimensions);
+    chunk.out = m_values.data();
+    parse_chunk(chunk, m_numDimensions);
+
+    m_rows        = m_values.data();
+    m_windowStart = first;
+    m_windowRows  = unsigned(m_values.size() / m_numDimensions);
+
+    // read ahead: ask the OS to page in the text for the following window while this one is being used
+    unsigned next_row = m_windowStart + m_windowRows;
+    if (next_row < m_numSamples)
+    {
+        size_t from = m_rowIndex[next_row / ROW_INDEX_STRIDE];
+        size_t to   = std::min<size_t>(next_row + m_windowSize, m_numSamples) / ROW_INDEX_STRIDE + 1;
+        to          = to < m_rowIndex.size() ? m_rowIndex[to] : m_file.size();
+        m_file.prefetch(from, to - from);
+    }
+}
+
+void CSVFile::prefetch(unsigned first, unsigned count)
+{
+    if (!m_streaming || (first >= m_windowStart && first + count <= m_windowStart + m_windowRows))
+        return;
+
+    loadWindow(first, std::max(count, m_windowSize));
+}
+
+void CSVFile::sampleRange(float points[], uint64_t first64, unsigned count, unsigned stride)
+{
+    assert(first64 + count <= m_numSamples);
+    unsigned first = unsigned(first64);
+    unsigned dims  = std::min(m_numDimensions, stride);
+    while (count)
+    {
+        if (first < m_windowStart || first >= m_windowStart + m_windowRows)
+            loadWindow(first, m_windowSize);
+
+        unsigned     n    = std::min(count, m_windowStart + m_windowRows - first);
+        const float *rows = m_rows + size_t(first - m_windowStart) * m_numDimensions;
+        // rows are stored back to back, so densely packed points are a single copy
+        if (stride == m_numDimensions)
+            memcpy(points, rows, size_t(n) * m_numDimensions * sizeof(float));
+        else
+            for (unsigned k = 0; k < n; ++k)
+                memcpy(points + size_t(k) * stride, rows + size_t(k) * m_numDimensions, dims * sizeof(float));
+        points += size_t(n) * stride;
+        first += n;
+        count -= n;
+    }
+}
+
 string CSVFile::name() const
 {
     return "CSV file: " + (m_filename.empty() ? string("<choose a file>") : fs::path{m_filename}.stem().string());
@@ -252,9 +872,15 @@ string CSVFile::name() const
 void CSVFile::sample(float r[], unsigned i)
 {
     assert(i < m_numSamples);
-    for (unsigned d = 0; d < dimensions(); ++d)
+    if (i < m_windowStart || i >= m_windowStart + m_windowRows)
     {
-        assert(i * m_numDimensions + d < m_values.size());
-        r[d] = m_values[i * m_numDimensions + d];
+        // slide the window forward from i, or backward so that it ends at i
+        if (i > m_windowStart)
+            loadWindow(i, m_windowSize);
+        else
+            loadWindow(i + 1 - std::min(i + 1, m_windowSize), m_windowSize);
     }
+
+    size_t offset = size_t(i - m_windowStart) * m_numDimensions;
+    for (unsigned d = 0; d < dimensions(); ++d) r[d] = m_rows[offset + d];
 }
@@ -67,3 +67,30 @@ void CascadedSobol::sample(float r[], unsigned i)
         index   = index >> (32 - nbits); // this will be used as new index for the next dimension
     }
 }
+
+void CascadedSobol::sampleUInt(uint32_t r[], unsigned i)
+{
+    assert(i < m_numSamples);
+
+    // same as sample(), but without scaling the result to [0,1]
+    const uint32_t owen_tree_depth = 32;
+    uint32_t       index           = i;
+    for (unsigned idim = 0; idim < m_numDimensions; idim++)
+    {
+        index   = sobols[idim].getSobolInt(index);
+        r[idim] = owen_permut_flag ? OwenScrambling(index, realSeeds[idim], owen_tree_depth) : index;
+        index   = index >> (32 - nbits);
+    }
+}
+
+void CascadedSobol::sampleUIntRange(uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleUIntRangeInline(*this, points, first, count, stride);
+}
+
+void CascadedSobol::sampleDouble(double r[], unsigned i) { sampleDoubleFromUInt(*this, r, i); }
+
+void CascadedSobol::sampleDoubleRange(double points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleDoubleRangeInline(*this, points, first, count, stride);
+}
@@ -79,3 +79,9 @@ void Faure::sample(float r[], unsigned i)
         r[d] = m_samples[s() * i + d];
     }
 }
+
+void Faure::sampleDouble(double r[], unsigned i)
+{
+    assert(i < m_numSamples);
+    for (unsigned d = 0; d < dimensions(); ++d) r[d] = m_samples[s() * i + d];
+}
@@ -67,9 +67,20 @@ int GrayCode::setNumSamples(unsigned num)
     return N;
 }
 
+int GrayCode::roundNumSamples(unsigned num) const
+{
+    int log2N = std::round(std::log2(num));
+    return 1 << (log2N + (log2N & 1));
+}
+
 void GrayCode::sample(float r[], unsigned i)
 {
     assert(i < N);
     r[0] = m_samples[i].x;
     r[1] = m_samples[i].y;
+}
+
+void GrayCode::sampleRange(float points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeInline(*this, points, first, count, stride);
 }
\ No newline at end of file
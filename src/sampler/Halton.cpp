@@ -32,9 +32,18 @@ void Halton::setSeed(uint32_t seed)
         initFaure();
 }
 
-void Halton::sample(float r[], unsigned i)
+void Halton::sample(float r[], unsigned i) { Halton::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void Halton::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
+    for (unsigned d = 0; d < m_numDimensions; d++)
+        if (hasDimension(mask, d))
+            r[d] = m_halton.sample(d, i);
+}
+
+void Halton::sampleDouble(double r[], unsigned i)
 {
-    for (unsigned d = 0; d < m_numDimensions; d++) r[d] = m_halton.sample(d, i);
+    for (unsigned d = 0; d < m_numDimensions; d++) r[d] = m_halton.sample<double>(d, i);
 }
 
 HaltonZaremba::HaltonZaremba(unsigned dimensions) : m_numDimensions(0) { setDimensions(dimensions); }
@@ -47,7 +56,20 @@ void HaltonZaremba::setDimensions(unsigned n)
     m_numDimensions = n;
 }
 
-void HaltonZaremba::sample(float r[], unsigned i)
+void HaltonZaremba::sample(float r[], unsigned i) { HaltonZaremba::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void HaltonZaremba::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
+    for (unsigned d = 0; d < m_numDimensions; d++)
+        if (hasDimension(mask, d))
+            r[d] = foldedRadicalInverse(i, nthPrime(d + 1));
+}
+
+void HaltonZaremba::sampleDouble(double r[], unsigned i)
 {
-    for (unsigned d = 0; d < m_numDimensions; d++) r[d] = foldedRadicalInverse(i, nthPrime(d + 1));
+    for (unsigned d = 0; d < m_numDimensions; d++)
+    {
+        int base = nthPrime(d + 1);
+        r[d]     = foldedRadicalInverse(i, base, 1.0 / base);
+    }
 }
@@ -11,8 +11,7 @@ void Jittered::sample(float r[], unsigned i)
 {
     i %= m_numSamples;
 
-    if (i == 0)
-        m_rand.seed(m_seed);
+    seekPoint(m_rand, pcg32(m_seed), i, 2 * ((dimensions() + 1) / 2));
 
     for (unsigned d = 0; d < dimensions(); d += 2)
     {
@@ -6,7 +6,7 @@
 #include <sampler/Misc.h>
 
 LarcherPillichshammerGK::LarcherPillichshammerGK(unsigned dimension, unsigned numSamples, uint32_t seed) :
-    m_numSamples(numSamples), m_numDimensions(dimension), m_inv(1.0f / m_numSamples)
+    m_numSamples(numSamples), m_numDimensions(dimension)
 {
     setSeed(seed);
 }
@@ -14,18 +14,62 @@ LarcherPillichshammerGK::LarcherPillichshammerGK(unsigned dimension, unsigned nu
 LarcherPillichshammerGK::~LarcherPillichshammerGK() {}
 
 void LarcherPillichshammerGK::sample(float r[], unsigned i)
+{
+    LarcherPillichshammerGK::sampleMasked(r, i, ALL_DIMENSIONS);
+}
+
+void LarcherPillichshammerGK::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     for (unsigned d = 0; d < dimensions(); d += 3)
     {
+        // the three dimensions of each group share the permuted index
+        bool use[3] = {hasDimension(mask, d), hasDimension(mask, d + 1), hasDimension(mask, d + 2)};
+        if (!use[0] && !use[1] && !use[2])
+            continue;
+
         int      s  = permute(i, m_numSamples, d);
         unsigned ds = 0x68bc21eb * (d + 1);
-        if (d < dimensions())
-            r[d] = randomDigitScramble(s * m_inv, m_scramble1 * ds);
+        if (use[0])
+            r[d] = (fixedPointStratum(s, m_numSamples) ^ (m_scramble1 * ds)) * 2.3283064365386962890625e-10f;
 
-        if (d + 1 < dimensions())
+        if (use[1] && d + 1 < dimensions())
             r[d + 1] = LarcherPillichshammerRI(s, m_scramble2 * ds);
 
-        if (d + 2 < dimensions())
+        if (use[2] && d + 2 < dimensions())
             r[d + 2] = GruenschlossKellerRI(s, m_scramble3 * ds);
     }
 }
+
+void LarcherPillichshammerGK::sampleRangeMasked(float points[], uint64_t first, unsigned count, unsigned stride,
+                                                DimensionMask mask)
+{
+    sampleRangeMaskedInline(*this, points, first, count, stride, mask);
+}
+
+void LarcherPillichshammerGK::sampleUInt(uint32_t r[], unsigned i)
+{
+    for (unsigned d = 0; d < dimensions(); d += 3)
+    {
+        int      s  = permute(i, m_numSamples, d);
+        unsigned ds = 0x68bc21eb * (d + 1);
+        r[d] = fixedPointStratum(s, m_numSamples) ^ (m_scramble1 * ds);
+
+        if (d + 1 < dimensions())
+            r[d + 1] = LarcherPillichshammerRIU(s, m_scramble2 * ds);
+
+        if (d + 2 < dimensions())
+            r[d + 2] = GruenschlossKellerRIU(s, m_scramble3 * ds);
+    }
+}
+
+void LarcherPillichshammerGK::sampleUIntRange(uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleUIntRangeInline(*this, points, first, count, stride);
+}
+
+void LarcherPillichshammerGK::sampleDouble(double r[], unsigned i) { sampleDoubleFromUInt(*this, r, i); }
+
+void LarcherPillichshammerGK::sampleDoubleRange(double points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleDoubleRangeInline(*this, points, first, count, stride);
+}
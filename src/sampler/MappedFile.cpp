@@ -0,0 +1,161 @@
+/** \file MappedFile.cpp
+    \author Wojciech Jarosz
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <sampler/MappedFile.h>
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using std::string;
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    close();
+    m_filename = std::move(other.m_filename);
+    m_data     = std::exchange(other.m_data, nullptr);
+    m_size     = std::exchange(other.m_size, 0);
+    m_open     = std::exchange(other.m_open, false);
+#if defined(_WIN32)
+    m_file    = std::exchange(other.m_file, nullptr);
+    m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+    m_fallback = std::move(other.m_fallback);
+    return *this;
+}
+
+void MappedFile::open(const string &filename)
+{
+    close();
+    m_filename = filename;
+
+#if defined(_WIN32)
+    m_file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                         FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE)
+    {
+        m_file = nullptr;
+        throw std::runtime_error("Cannot open file \"" + filename + "\"");
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size))
+    {
+        close();
+        throw std::runtime_error("Cannot determine the size of file \"" + filename + "\"");
+    }
+    m_size = (size_t)size.QuadPart;
+    m_open = true;
+
+    // empty files cannot be mapped, but are still valid
+    if (m_size == 0)
+        return;
+
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping)
+        m_data = (const char *)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!m_data)
+    {
+        close();
+        throw std::runtime_error("Cannot memory map file \"" + filename + "\"");
+    }
+#elif !defined(__EMSCRIPTEN__)
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open file \"" + filename + "\"");
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        throw std::runtime_error("Cannot determine the size of file \"" + filename + "\"");
+    }
+    m_size = (size_t)st.st_size;
+    m_open = true;
+
+    // empty files cannot be mapped, but are still valid
+    if (m_size == 0)
+    {
+        ::close(fd);
+        return;
+    }
+
+    void *ptr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps its own reference to the file
+    ::close(fd);
+    if (ptr == MAP_FAILED)
+    {
+        m_size = 0;
+        m_open = false;
+        throw std::runtime_error("Cannot memory map file \"" + filename + "\"");
+    }
+    madvise(ptr, m_size, MADV_SEQUENTIAL);
+    m_data = (const char *)ptr;
+#else
+    std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+    if (!stream)
+        throw std::runtime_error("Cannot open file \"" + filename + "\"");
+
+    m_fallback.resize((size_t)stream.tellg());
+    stream.seekg(0);
+    if (!stream.read(m_fallback.data(), m_fallback.size()))
+        throw std::runtime_error("Cannot read file \"" + filename + "\"");
+
+    m_size = m_fallback.size();
+    m_data = m_size ? m_fallback.data() : nullptr;
+    m_open = true;
+#endif
+}
+
+void MappedFile::close()
+{
+#if defined(_WIN32)
+    if (m_data)
+        UnmapViewOfFile(m_data);
+    if (m_mapping)
+        CloseHandle(m_mapping);
+    if (m_file)
+        CloseHandle(m_file);
+    m_mapping = m_file = nullptr;
+#elif !defined(__EMSCRIPTEN__)
+    if (m_data)
+        munmap((void *)m_data, m_size);
+#endif
+    m_fallback.clear();
+    m_fallback.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+}
+
+void MappedFile::prefetch(size_t offset, size_t length) const
+{
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    if (!m_data || offset >= m_size)
+        return;
+
+    length = std::min(length, m_size - offset);
+
+    // madvise requires a page-aligned start address
+    size_t page  = (size_t)sysconf(_SC_PAGESIZE);
+    size_t start = offset / page * page;
+    madvise((void *)(m_data + start), offset + length - start, MADV_WILLNEED);
+#endif
+}
@@ -76,7 +76,12 @@ void MultiJittered::sample(float r[], unsigned i)
     if (i >= m_numSamples)
         i = 0;
 
-    for (unsigned d = 0; d < dimensions(); d++) r[d] = (m_samples[d][i]) * m_scale;
+    for (unsigned d = 0; d < DIMENSION; d++) r[d] = (m_samples[d][i]) * m_scale;
+}
+
+void MultiJittered::sampleRange(float points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeInline(*this, points, first, count, stride);
 }
 
 MultiJitteredInPlace::MultiJitteredInPlace(unsigned x, unsigned y, uint32_t seed, float jitter) :
@@ -101,8 +106,7 @@ void MultiJitteredInPlace::sample(float r[], unsigned i)
 {
     i = i % m_numSamples;
 
-    if (i == 0)
-        m_rand.seed(m_seed);
+    seekPoint(m_rand, pcg32(m_seed), i, 2);
 
     // i is the (possibly permuted) sample index
     i = permute(i, m_numSamples, m_permutation * 0x51633e2d);
@@ -186,8 +190,7 @@ void CorrelatedMultiJitteredInPlace::sample(float r[], unsigned i)
 {
     i %= m_numSamples;
 
-    if (i == 0)
-        m_rand.seed(m_seed);
+    seekPoint(m_rand, pcg32(m_seed), i, 2 * ((dimensions() + 1) / 2));
 
     for (unsigned d = 0; d < dimensions(); d += 2)
     {
@@ -35,16 +35,28 @@ void NRooks::reset()
         if (m_seed)
             m_permutations[d].shuffle(m_rand);
     }
+    m_jitterStart = m_rand;
 }
 
-void NRooks::sample(float r[], unsigned i)
+void NRooks::sample(float r[], unsigned i) { NRooks::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void NRooks::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     if (i >= m_numSamples)
         i = 0;
 
+    seekPoint(m_rand, m_jitterStart, i, dimensions());
+
     float jitter = m_maxJit * (m_seed != 0);
     for (unsigned d = 0; d < dimensions(); d++)
+    {
+        if (!hasDimension(mask, d))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         r[d] = (m_permutations[d][i] + 0.5f + jitter * (m_rand.nextFloat() - 0.5f)) * m_scale;
+    }
 }
 
 NRooksInPlace::NRooksInPlace(unsigned dim, unsigned n, uint32_t seed, float j) :
@@ -66,15 +78,23 @@ void NRooksInPlace::reset()
     for (unsigned d = 0; d < dimensions(); ++d) m_scrambles[d] = m_seed ? m_rand.nextUInt() : 0;
 }
 
-void NRooksInPlace::sample(float r[], unsigned i)
+void NRooksInPlace::sample(float r[], unsigned i) { NRooksInPlace::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void NRooksInPlace::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     if (i >= m_numSamples)
         i = 0;
 
-    if (i == 0)
-        m_rand.seed(m_seed);
+    seekPoint(m_rand, pcg32(m_seed), i, dimensions());
 
     float jitter = m_maxJit * (m_seed != 0);
     for (unsigned d = 0; d < dimensions(); d++)
+    {
+        if (!hasDimension(mask, d))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         r[d] = (permute(i, m_numSamples, m_scrambles[d]) + 0.5f + jitter * (m_rand.nextFloat() - 0.5f)) / m_numSamples;
+    }
 }
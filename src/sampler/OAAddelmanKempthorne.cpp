@@ -99,10 +99,20 @@ int AddelmanKempthorneOAInPlace::setNumSamples(unsigned n)
     return m_numSamples;
 }
 
+int AddelmanKempthorneOAInPlace::roundNumSamples(unsigned n) const
+{
+    unsigned s = primeGE(max(3, (int)round(sqrt(n * 0.5f))));
+    return 2 * s * s;
+}
+
 void AddelmanKempthorneOAInPlace::sample(float r[], unsigned row)
 {
-    if (row == 0)
-        m_rand.seed(m_seed);
+    AddelmanKempthorneOAInPlace::sampleMasked(r, row, ALL_DIMENSIONS);
+}
+
+void AddelmanKempthorneOAInPlace::sampleMasked(float r[], unsigned row, DimensionMask mask)
+{
+    seekPoint(m_rand, pcg32(m_seed), row, min(dimensions(), 2 * m_s + 1));
 
     const Galois::Element i(&m_gf, (row / m_s) % m_s);
     const Galois::Element j(&m_gf, row % m_s);
@@ -137,6 +147,11 @@ void AddelmanKempthorneOAInPlace::sample(float r[], unsigned row)
 
         for (unsigned dim = 0; dim < 2 * m_s + 1 && dim < dimensions(); ++dim)
         {
+            if (!hasDimension(mask, dim))
+            {
+                m_rand.nextUInt(); // skip this dimension's jitter
+                continue;
+            }
             int Acol     = Adim(dim);
             int k        = (dim % 2) ? dim - 1 : (dim + 1) % (2 * m_s + 1);
             int Aik      = Adim(k);
@@ -171,7 +186,9 @@ void AddelmanKempthorneOAInPlace::sample(float r[], unsigned row)
     else
     {
         // Second q*q rows
-        for (size_t dim = 0; dim < dimensions(); ++dim) r[dim] = 0.0f;
+        for (unsigned dim = 0; dim < dimensions(); ++dim)
+            if (hasDimension(mask, dim))
+                r[dim] = 0.0f;
 
         vector<int>     b(m_s);
         vector<int>     c(m_s);
@@ -207,6 +224,11 @@ void AddelmanKempthorneOAInPlace::sample(float r[], unsigned row)
 
         for (unsigned dim = 0; dim < 2 * m_s + 1 && dim < dimensions(); ++dim)
         {
+            if (!hasDimension(mask, dim))
+            {
+                m_rand.nextUInt(); // skip this dimension's jitter
+                continue;
+            }
             int Acol     = Adim(dim);
             int k        = (dim % 2) ? dim - 1 : (dim + 1) % (2 * m_s + 1);
             int Aik      = Adim(k);
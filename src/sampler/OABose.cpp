@@ -54,6 +54,12 @@ void BoseOA::setNumSamples(unsigned x, unsigned)
     reset();
 }
 
+int BoseOA::roundNumSamples(unsigned n) const
+{
+    unsigned s = primeGE((n == 0) ? 1 : (int)(sqrt((float)n) + 0.5f));
+    return s * s;
+}
+
 void BoseOA::clear()
 {
     if (m_samples)
@@ -191,17 +197,23 @@ void BoseOA::reset()
     }
 }
 
-void BoseOA::sample(float r[], unsigned i)
+void BoseOA::sample(float r[], unsigned i) { BoseOA::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void BoseOA::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     if (i >= m_numSamples)
         i = 0;
 
-    if (i == 0)
-        m_rand.seed(m_seed);
+    seekPoint(m_rand, pcg32(m_seed), i, dimensions());
 
     float jitter = (m_seed != 0) * m_maxJit;
     for (unsigned d = 0; d < dimensions(); d++)
     {
+        if (!hasDimension(mask, d))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         switch (m_ot)
         {
         case CENTERED:
@@ -214,6 +226,16 @@ void BoseOA::sample(float r[], unsigned i)
     }
 }
 
+void BoseOA::sampleRange(float points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeInline(*this, points, first, count, stride);
+}
+
+void BoseOA::sampleRangeMasked(float points[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask)
+{
+    sampleRangeMaskedInline(*this, points, first, count, stride, mask);
+}
+
 BoseOAInPlace::BoseOAInPlace(unsigned x, OffsetType ot, uint32_t seed, float jitter, unsigned dimensions) :
     OrthogonalArray(2, ot, seed, jitter), m_s(x), m_numSamples(m_s * m_s), m_numDimensions(dimensions)
 {
@@ -236,14 +258,20 @@ void BoseOAInPlace::setNumSamples(unsigned x, unsigned)
     reset();
 }
 
+int BoseOAInPlace::roundNumSamples(unsigned n) const
+{
+    unsigned s = primeGE((n == 0) ? 1 : (int)(sqrt((float)n) + 0.5f));
+    return s * s;
+}
+
 void BoseOAInPlace::reset() { m_rand.seed(m_seed); }
 
-void BoseOAInPlace::sample(float r[], unsigned i)
-{
-    if (i == 0)
-        m_rand.seed(m_seed);
+void BoseOAInPlace::sample(float r[], unsigned i) { BoseOAInPlace::sampleMasked(r, i, ALL_DIMENSIONS); }
 
+void BoseOAInPlace::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
     unsigned maxDim = min(dimensions(), m_s + 1);
+    seekPoint(m_rand, pcg32(m_seed), i, max(2u, maxDim));
 
     int   stratumX = i / m_s;
     int   stratumY = i % m_s;
@@ -253,11 +281,18 @@ void BoseOAInPlace::sample(float r[], unsigned i)
     float sstratY  = boseLHOffset(Ai1, Ai0, m_s, m_seed * 2 * 0x68bc21eb, m_ot);
     float jitterX  = 0.5f + int(m_seed != 0) * m_maxJit * (m_rand.nextFloat() - 0.5f);
     float jitterY  = 0.5f + int(m_seed != 0) * m_maxJit * (m_rand.nextFloat() - 0.5f);
-    r[0]           = (stratumX + (sstratX + jitterX) / m_s) / m_s;
-    r[1]           = (stratumY + (sstratY + jitterY) / m_s) / m_s;
+    if (hasDimension(mask, 0))
+        r[0] = (stratumX + (sstratX + jitterX) / m_s) / m_s;
+    if (hasDimension(mask, 1))
+        r[1] = (stratumY + (sstratY + jitterY) / m_s) / m_s;
 
     for (unsigned j = 2; j < maxDim; ++j)
     {
+        if (!hasDimension(mask, j))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int   Aij      = (Ai0 + (j - 1) * Ai1) % m_s;
         int   k        = (j % 2) ? j - 1 : j + 1;
         int   Aik      = (Ai0 + (k - 1) * Ai1) % m_s;
@@ -267,7 +302,9 @@ void BoseOAInPlace::sample(float r[], unsigned i)
         r[j]           = (stratumJ + (sstratJ + jitterJ) / m_s) / m_s;
     }
 
-    for (unsigned j = maxDim; j < dimensions(); ++j) r[j] = 0.5f;
+    for (unsigned j = maxDim; j < dimensions(); ++j)
+        if (hasDimension(mask, j))
+            r[j] = 0.5f;
 }
 
 BoseSudokuInPlace::BoseSudokuInPlace(unsigned x, OffsetType ot, uint32_t seed, float jitter, unsigned dimensions) :
@@ -295,13 +332,21 @@ void BoseSudokuInPlace::setNumSamples(unsigned x, unsigned)
     reset();
 }
 
-void BoseSudokuInPlace::sample(float r[], unsigned i)
+int BoseSudokuInPlace::roundNumSamples(unsigned n) const
+{
+    unsigned s = primeGE(std::max(1, (int)round(std::pow((float)n, 0.25f))));
+    return s * s * s * s;
+}
+
+void BoseSudokuInPlace::sample(float r[], unsigned i) { BoseSudokuInPlace::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void BoseSudokuInPlace::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     if (i >= m_numSamples)
         i = 0;
 
-    if (i == 0)
-        m_rand.seed(m_seed);
+    unsigned maxDim = min(dimensions(), m_s + 1);
+    seekPoint(m_rand, pcg32(m_seed), i, max(2u, maxDim));
 
     // which digit of the sudoku puzzle we are considering
     unsigned digit = permute(i / m_numDigits, m_numDigits, m_seed * 0x1fc195a7);
@@ -310,8 +355,6 @@ void BoseSudokuInPlace::sample(float r[], unsigned i)
     int px = digit % m_s;
     int py = digit / m_s;
 
-    unsigned maxDim = min(dimensions(), m_s + 1);
-
     // make i specify the sample index within the digit
     i = permute(i % m_numDigits, m_numDigits, m_seed);
 
@@ -323,11 +366,18 @@ void BoseSudokuInPlace::sample(float r[], unsigned i)
     float sstratY  = boseLHOffset(Ai1, (Ai0 + px) % m_s, m_s, m_seed * 2 * 0x68bc21eb, m_ot);
     float jitterX  = 0.5f + int(m_seed != 0) * m_maxJit * (m_rand.nextFloat() - 0.5f);
     float jitterY  = 0.5f + int(m_seed != 0) * m_maxJit * (m_rand.nextFloat() - 0.5f);
-    r[0]           = (stratumX + (sstratX + jitterX) / m_s) / m_s;
-    r[1]           = (stratumY + (sstratY + jitterY) / m_s) / m_s;
+    if (hasDimension(mask, 0))
+        r[0] = (stratumX + (sstratX + jitterX) / m_s) / m_s;
+    if (hasDimension(mask, 1))
+        r[1] = (stratumY + (sstratY + jitterY) / m_s) / m_s;
 
     for (unsigned j = 2; j < maxDim; ++j)
     {
+        if (!hasDimension(mask, j))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int   Aij      = (Ai0 + (j - 1) * Ai1) % m_s;
         int   k        = (j % 2) ? j - 1 : j + 1;
         int   pk       = (py + (k - 1) * px) % m_s;
@@ -338,7 +388,9 @@ void BoseSudokuInPlace::sample(float r[], unsigned i)
         r[j]           = (stratumJ + (sstratJ + jitterJ) / m_s) / m_s;
     }
 
-    for (unsigned j = maxDim; j < dimensions(); ++j) r[j] = 0.5f;
+    for (unsigned j = maxDim; j < dimensions(); ++j)
+        if (hasDimension(mask, j))
+            r[j] = 0.5f;
 }
 
 //
@@ -364,10 +416,18 @@ int BoseGaloisOAInPlace::setNumSamples(unsigned n)
     return m_numSamples;
 }
 
-void BoseGaloisOAInPlace::sample(float r[], unsigned i)
+int BoseGaloisOAInPlace::roundNumSamples(unsigned n) const
 {
-    if (i == 0)
-        m_rand.seed(m_seed);
+    unsigned s = primePowerGE(max(2, (int)round(sqrt(n))));
+    return s * s;
+}
+
+void BoseGaloisOAInPlace::sample(float r[], unsigned i) { BoseGaloisOAInPlace::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void BoseGaloisOAInPlace::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
+    unsigned maxDim = min(dimensions(), m_s + 1);
+    seekPoint(m_rand, pcg32(m_seed), i, max(2u, maxDim));
 
     int             stratumX = i / m_s;
     int             stratumY = i % m_s;
@@ -377,12 +437,18 @@ void BoseGaloisOAInPlace::sample(float r[], unsigned i)
     float           sstratY = boseLHOffset(Ai1.value(), Ai0.value(), m_s, m_seed * 2 * 0x68bc21eb, m_ot);
     float           jitterX = 0.5f + int(m_seed != 0) * m_maxJit * (m_rand.nextFloat() - 0.5f);
     float           jitterY = 0.5f + int(m_seed != 0) * m_maxJit * (m_rand.nextFloat() - 0.5f);
-    r[0]                    = (stratumX + (sstratX + jitterX) / m_s) / m_s;
-    r[1]                    = (stratumY + (sstratY + jitterY) / m_s) / m_s;
+    if (hasDimension(mask, 0))
+        r[0] = (stratumX + (sstratX + jitterX) / m_s) / m_s;
+    if (hasDimension(mask, 1))
+        r[1] = (stratumY + (sstratY + jitterY) / m_s) / m_s;
 
-    unsigned maxDim = min(dimensions(), m_s + 1);
     for (unsigned j = 2; j < maxDim; ++j)
     {
+        if (!hasDimension(mask, j))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int   km1      = (j % 2) ? j - 2 : j % m_s;
         int   Aij      = (Ai0 + (j - 1) * Ai1).value();
         int   Aik      = (Ai0 + km1 * Ai1).value();
@@ -392,5 +458,7 @@ void BoseGaloisOAInPlace::sample(float r[], unsigned i)
         r[j]           = (stratumJ + (sstratJ + jitterJ) / m_s) / m_s;
     }
 
-    for (unsigned j = maxDim; j < dimensions(); ++j) r[j] = 0.5f;
+    for (unsigned j = maxDim; j < dimensions(); ++j)
+        if (hasDimension(mask, j))
+            r[j] = 0.5f;
 }
@@ -30,6 +30,12 @@ int BoseBushOA::setNumSamples(unsigned n)
     return m_numSamples;
 }
 
+int BoseBushOA::roundNumSamples(unsigned n) const
+{
+    int s = max(2, (int)pow(2.f, ceil(log2(sqrt(n / 2)))));
+    return 2 * s * s;
+}
+
 void BoseBushOA::reset()
 {
     BoseOAInPlace::reset();
@@ -61,13 +67,22 @@ void BoseBushOA::reset()
     }
 }
 
-void BoseBushOA::sample(float r[], unsigned row)
+void BoseBushOA::sample(float r[], unsigned row) { BoseBushOA::sampleMasked(r, row, ALL_DIMENSIONS); }
+
+void BoseBushOA::sampleMasked(float r[], unsigned row, DimensionMask mask)
 {
     int      q = m_gf.q;
     unsigned s = q / 2; /* number of levels in design */
 
+    seekPoint(m_rand, pcg32(m_seed), row, min(dimensions(), 2 * s + 1));
+
     for (unsigned dim = 0; dim < dimensions() && dim < 2 * s + 1; ++dim)
     {
+        if (!hasDimension(mask, dim))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int Acol     = m_B(row, dim);
         int stratumJ = permute(Acol, m_s, m_seed * (dim + 1));
 
@@ -96,16 +111,31 @@ int BoseBushOAInPlace::setNumSamples(unsigned n)
     return m_numSamples;
 }
 
-void BoseBushOAInPlace::sample(float r[], unsigned row)
+int BoseBushOAInPlace::roundNumSamples(unsigned n) const
+{
+    int s = max(2, (int)pow(2.f, ceil(log2(sqrt(n / 2)))));
+    return 2 * s * s;
+}
+
+void BoseBushOAInPlace::sample(float r[], unsigned row) { BoseBushOAInPlace::sampleMasked(r, row, ALL_DIMENSIONS); }
+
+void BoseBushOAInPlace::sampleMasked(float r[], unsigned row, DimensionMask mask)
 {
     int      q = m_gf.q;
     unsigned s = q / 2; /* number of levels in design */
 
+    seekPoint(m_rand, pcg32(m_seed), row, min(dimensions(), 2 * s + 1));
+
     unsigned              i = row / s;
     const Galois::Element gi(&m_gf, i);
 
     for (unsigned dim = 0; dim < dimensions() && dim < 2 * s + 1; ++dim)
     {
+        if (!hasDimension(mask, dim))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int A = (dim < 2 * s) ? (((gi * dim) % s) + (row % s)).value() : i % s;
 
         int stratumJ = permute(A, m_s, m_seed * (dim + 1));
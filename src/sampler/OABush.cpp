@@ -52,11 +52,16 @@ void BushOAInPlace::setNumSamples(unsigned x, unsigned)
     reset();
 }
 
-void BushOAInPlace::sample(float r[], unsigned i)
+int BushOAInPlace::roundNumSamples(unsigned n) const
 {
-    if (i == 0)
-        m_rand.seed(m_seed);
+    unsigned s = primeGE((n == 0) ? 1 : (int)(pow((float)n, 1.f / m_t) + 0.5f));
+    return int(pow(s, m_t));
+}
+
+void BushOAInPlace::sample(float r[], unsigned i) { BushOAInPlace::sampleMasked(r, i, ALL_DIMENSIONS); }
 
+void BushOAInPlace::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
     // compute polynomial coefficients
     auto coeffs = iToPolyCoeffs(i, m_s, m_t);
 
@@ -64,8 +69,14 @@ void BushOAInPlace::sample(float r[], unsigned i)
     unsigned add          = m_ot == CMJ_STYLE ? 1 : 0;
     unsigned maxDim       = min(dimensions(), m_s - add);
     unsigned s            = m_s;
+    seekPoint(m_rand, pcg32(m_seed), i, maxDim);
     for (unsigned d = 0; d < maxDim; ++d)
     {
+        if (!hasDimension(mask, d))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int phi     = polyEval(coeffs, d + add);
         int stratum = permute(phi % m_s, m_s, m_seed * (d + 1));
 
@@ -75,7 +86,9 @@ void BushOAInPlace::sample(float r[], unsigned i)
         r[d]         = (stratum + (subStratum + jitter) / numSubStrata) / s;
     }
 
-    for (unsigned d = maxDim; d < dimensions(); ++d) r[d] = 0.5f;
+    for (unsigned d = maxDim; d < dimensions(); ++d)
+        if (hasDimension(mask, d))
+            r[d] = 0.5f;
 }
 
 ////
@@ -104,11 +117,16 @@ void BushGaloisOAInPlace::setNumSamples(unsigned x, unsigned)
     reset();
 }
 
-void BushGaloisOAInPlace::sample(float r[], unsigned i)
+int BushGaloisOAInPlace::roundNumSamples(unsigned n) const
 {
-    if (i == 0)
-        m_rand.seed(m_seed);
+    unsigned s = primePowerGE((n == 0) ? 1 : (int)(pow((float)n, 1.f / m_t) + 0.5f));
+    return int(pow(s, m_t));
+}
+
+void BushGaloisOAInPlace::sample(float r[], unsigned i) { BushGaloisOAInPlace::sampleMasked(r, i, ALL_DIMENSIONS); }
 
+void BushGaloisOAInPlace::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
     // compute polynomial coefficients
     auto coeffs = iToPolyCoeffs(i, m_s, m_t);
 
@@ -116,8 +134,14 @@ void BushGaloisOAInPlace::sample(float r[], unsigned i)
     unsigned add          = m_ot == CMJ_STYLE ? 1 : 0;
     unsigned maxDim       = min(dimensions(), m_s - add);
     unsigned s            = m_s;
+    seekPoint(m_rand, pcg32(m_seed), i, maxDim);
     for (unsigned d = 0; d < maxDim; ++d)
     {
+        if (!hasDimension(mask, d))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int phi     = polyEval(&m_gf, coeffs, d + add);
         int stratum = permute(phi, m_s, m_seed * (d + 1));
 
@@ -127,5 +151,7 @@ void BushGaloisOAInPlace::sample(float r[], unsigned i)
         r[d]         = (stratum + (subStratum + jitter) / numSubStrata) / s;
     }
 
-    for (unsigned d = maxDim; d < dimensions(); ++d) r[d] = 0.5f;
+    for (unsigned d = maxDim; d < dimensions(); ++d)
+        if (hasDimension(mask, d))
+            r[d] = 0.5f;
 }
\ No newline at end of file
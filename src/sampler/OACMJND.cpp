@@ -25,10 +25,11 @@ void CMJNDInPlace::reset()
     m_strataPermute = m_seed ? m_rand.nextUInt() : 0;
 }
 
-void CMJNDInPlace::sample(float point[], unsigned i)
+void CMJNDInPlace::sample(float point[], unsigned i) { CMJNDInPlace::sampleMasked(point, i, ALL_DIMENSIONS); }
+
+void CMJNDInPlace::sampleMasked(float point[], unsigned i, DimensionMask mask)
 {
-    if (i == 0)
-        m_rand.seed(m_seed);
+    seekPoint(m_rand, pcg32(m_seed), i, dimensions());
 
     // i = permute(i, m_numSamples, m_permutation);
 
@@ -39,6 +40,11 @@ void CMJNDInPlace::sample(float point[], unsigned i)
     int period = m_numSamples / m_base;
     for (unsigned d = 0; d < dimensions(); d++)
     {
+        if (!hasDimension(mask, d))
+        {
+            m_rand.nextUInt(); // skip this dimension's jitter
+            continue;
+        }
         int   stratum = permute(coeffs.at(d), m_base, m_strataPermute);
         float jitter  = 0.5f + m_maxJit * (m_rand.nextFloat() - 0.5f);
 
@@ -66,7 +72,7 @@ void CMJNDInPlace::sample(float point[], unsigned i)
                 // jitter to account for the fact that we divide by period below
                 // and not m_base
                 offset *= period / m_base;
-                jitter *= m_base;
+                jitter *= period / m_base;
             }
             else
             {
@@ -99,6 +105,12 @@ void CMJNDInPlace::sample(float point[], unsigned i)
             // end old version
             //
         }
+        else // J_STYLE
+        {
+            // a random substratum for each point, without enforcing latin hypercubes
+            int subStratum = permute(0, period, (i + 1) * m_strataPermute * 0x51633e2d * (d + 1));
+            point[d]       = (stratum + (subStratum + jitter) / period) / m_base;
+        }
     }
 }
 
@@ -0,0 +1,186 @@
+/** \file PointFile.cpp
+    \author Wojciech Jarosz
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <sampler/PointFile.h>
+#include <stdexcept>
+
+using std::string;
+using std::string_view;
+
+namespace
+{
+
+constexpr char NPY_MAGIC[6] = {'\x93', 'N', 'U', 'M', 'P', 'Y'};
+
+template <typename T>
+T read_le(const char *p)
+{
+    T value = 0;
+    for (size_t b = 0; b < sizeof(T); ++b) value |= T((unsigned char)p[b]) << (8 * b);
+    return value;
+}
+
+/// Return the value following `'key':` in a python dictionary literal, with surrounding whitespace removed
+string_view npy_value(string_view dict, string_view key)
+{
+    auto k = dict.find("'" + string(key) + "'");
+    if (k == string_view::npos)
+        throw std::runtime_error("npy header has no '" + string(key) + "' entry");
+
+    auto malformed = [&key] { return std::runtime_error("npy header has a malformed '" + string(key) + "' entry"); };
+
+    auto colon = dict.find(':', k);
+    if (colon == string_view::npos)
+        throw malformed();
+    auto begin = dict.find_first_not_of(" ", colon + 1);
+    if (begin == string_view::npos)
+        throw malformed();
+    // values are either quoted strings, tuples, or identifiers
+    auto end = dict[begin] == '(' ? dict.find(')', begin)
+               : dict[begin] == '\'' ? dict.find('\'', begin + 1)
+                                     : dict.find_first_of(",}", begin);
+    if (end == string_view::npos)
+        throw malformed();
+    if (dict[begin] == '(' || dict[begin] == '\'')
+        ++end;
+    return dict.substr(begin, end - begin);
+}
+
+bool parse_npy_header(string_view data, PointFileInfo &info)
+{
+    if (data.size() < 10 || memcmp(data.data(), NPY_MAGIC, sizeof(NPY_MAGIC)) != 0)
+        return false;
+
+    unsigned major = (unsigned char)data[6];
+    size_t   header_len, header_start;
+    if (major == 1)
+    {
+        header_len   = read_le<uint16_t>(data.data() + 8);
+        header_start = 10;
+    }
+    else if (major == 2 || major == 3)
+    {
+        if (data.size() < 12)
+            throw std::runtime_error("Truncated npy header");
+        header_len   = read_le<uint32_t>(data.data() + 8);
+        header_start = 12;
+    }
+    else
+        throw std::runtime_error("Unsupported npy version " + std::to_string(major));
+
+    if (data.size() < header_start + header_len)
+        throw std::runtime_error("Truncated npy header");
+
+    string_view dict = data.substr(header_start, header_len);
+
+    auto descr = npy_value(dict, "descr");
+    if (descr == "'<f4'")
+        info.dtype = PointFileHeader::Float32;
+    else if (descr == "'<u4'")
+        info.dtype = PointFileHeader::UInt32;
+    else if (descr == "'<f8'")
+        info.dtype = PointFileHeader::Float64;
+    else
+        throw std::runtime_error("Unsupported npy data type " + string(descr) + "; expected '<f4', '<u4' or '<f8'");
+
+    if (npy_value(dict, "fortran_order") != "False")
+        throw std::runtime_error("Fortran-ordered npy arrays are not supported");
+
+    // shape is either (N,) or (N, D)
+    auto     shape = npy_value(dict, "shape");
+    uint64_t dims[2]{0, 1};
+    int      num_dims = 0;
+    for (size_t i = 1; i < shape.size() && num_dims <= 2;)
+    {
+        i = shape.find_first_of("0123456789", i);
+        if (i == string_view::npos)
+            break;
+        auto end = shape.find_first_not_of("0123456789", i);
+        if (num_dims < 2)
+            dims[num_dims] = std::stoull(string(shape.substr(i, end - i)));
+        ++num_dims;
+        i = end;
+    }
+    if (num_dims < 1 || num_dims > 2)
+        throw std::runtime_error("Expected a 1D or 2D npy array, but got shape " + string(shape));
+
+    info.numPoints     = dims[0];
+    info.numDimensions = uint32_t(dims[1]);
+    info.dataOffset    = header_start + header_len;
+    info.sampler.clear();
+    info.seed = 0;
+    return true;
+}
+
+} // namespace
+
+bool parsePointFileHeader(string_view data, PointFileInfo &info)
+{
+    if (parse_npy_header(data, info))
+        return true;
+
+    if (data.size() < sizeof(PointFileHeader) || memcmp(data.data(), PointFileHeader::MAGIC, 4) != 0)
+        return false;
+
+    const char *p       = data.data();
+    uint32_t    version = read_le<uint32_t>(p + offsetof(PointFileHeader, version));
+    if (version > PointFileHeader::VERSION)
+        throw std::runtime_error("Unsupported point file version " + std::to_string(version));
+
+    info.numPoints     = read_le<uint64_t>(p + offsetof(PointFileHeader, num_points));
+    info.numDimensions = read_le<uint32_t>(p + offsetof(PointFileHeader, num_dimensions));
+    info.dtype         = read_le<uint32_t>(p + offsetof(PointFileHeader, dtype));
+    info.seed          = read_le<uint32_t>(p + offsetof(PointFileHeader, seed));
+    info.dataOffset    = sizeof(PointFileHeader);
+
+    const char *name = p + offsetof(PointFileHeader, sampler);
+    info.sampler     = string(name, std::find(name, name + sizeof(PointFileHeader::sampler), '\0'));
+
+    if (info.dtype != PointFileHeader::Float32 && info.dtype != PointFileHeader::UInt32 &&
+        info.dtype != PointFileHeader::Float64)
+        throw std::runtime_error("Unsupported point file data type " + std::to_string(info.dtype));
+
+    return true;
+}
+
+string pointFileHeader(uint64_t n, uint32_t d, uint32_t dtype, const string &sampler, uint32_t seed)
+{
+    string out(sizeof(PointFileHeader), '\0');
+    auto   write_le = [&out](size_t offset, uint64_t value, size_t bytes)
+    {
+        for (size_t b = 0; b < bytes; ++b) out[offset + b] = char((value >> (8 * b)) & 0xff);
+    };
+
+    memcpy(&out[0], PointFileHeader::MAGIC, 4);
+    write_le(offsetof(PointFileHeader, version), PointFileHeader::VERSION, 4);
+    write_le(offsetof(PointFileHeader, num_points), n, 8);
+    write_le(offsetof(PointFileHeader, num_dimensions), d, 4);
+    write_le(offsetof(PointFileHeader, dtype), dtype, 4);
+    write_le(offsetof(PointFileHeader, seed), seed, 4);
+    // keep room for the terminating null
+    memcpy(&out[offsetof(PointFileHeader, sampler)], sampler.data(),
+           std::min(sampler.size(), sizeof(PointFileHeader::sampler) - 1));
+    return out;
+}
+
+string npyHeader(uint64_t n, uint32_t d, uint32_t dtype)
+{
+    const char *descr = dtype == PointFileHeader::UInt32 ? "<u4" : dtype == PointFileHeader::Float64 ? "<f8" : "<f4";
+    string      dict  = "{'descr': '" + string(descr) + "', 'fortran_order': False, 'shape': (" + std::to_string(n) +
+                  ", " + std::to_string(d) + "), }";
+
+    // pad with spaces and a final newline so that the data starts at a multiple of 64 bytes
+    size_t total = (10 + dict.size() + 1 + 63) / 64 * 64;
+    dict.resize(total - 10 - 1, ' ');
+    dict += '\n';
+
+    string out(NPY_MAGIC, sizeof(NPY_MAGIC));
+    out += '\x01';
+    out += '\x00';
+    out += char(dict.size() & 0xff);
+    out += char((dict.size() >> 8) & 0xff);
+    return out + dict;
+}
@@ -2,19 +2,59 @@
     \author Wojciech Jarosz
 */
 
+#include <sampler/Misc.h>
 #include <sampler/Random.h>
 
-Random::Random(unsigned dimensions, uint64_t seed) : m_numDimensions(dimensions), m_rand(seed)
+Random::Random(unsigned dimensions, uint64_t seed) : m_numDimensions(dimensions), m_seed(seed), m_rand(seed)
 {
     setDimensions(dimensions);
 }
 
-void Random::sample(float r[], unsigned)
+void Random::sample(float r[], unsigned i)
 {
+    sample64(r, i);
+}
+
+void Random::sample64(float r[], uint64_t i)
+{
+    seekPoint(m_rand, pcg32(m_seed), i, dimensions());
     for (unsigned d = 0; d < dimensions(); d++)
         r[d] = m_rand.nextFloat();
 }
 
+void Random::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
+    sampleRangeMasked(r, i, 1, dimensions(), mask);
+}
+
+void Random::sampleRangeMasked(float points[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask)
+{
+    for (unsigned k = 0; k < count; ++k)
+    {
+        float *r = points + size_t(k) * stride;
+        seekPoint(m_rand, pcg32(m_seed), first + k, dimensions());
+        // seek to each selected dimension, jumping over the draws of the others
+        for (unsigned d = 0, next = 0; d < dimensions(); d++)
+        {
+            if (!hasDimension(mask, d))
+                continue;
+            m_rand.advance(d - next);
+            r[d] = m_rand.nextFloat();
+            next = d + 1;
+        }
+    }
+}
+
+uint32_t Random::seed() const
+{
+    return m_seed == PCG32_DEFAULT_STATE ? 0 : uint32_t(m_seed);
+}
+
+void Random::setSeed(uint32_t seed)
+{
+    m_seed = seed ? seed : PCG32_DEFAULT_STATE;
+}
+
 void Random::setDimensions(unsigned n)
 {
     if (n < 1)
@@ -10,23 +10,67 @@
 #include "sampling/ssobol.h"
 #include "sobol.h"
 
+namespace
+{
+
+/// The 32-bit integer coordinate that sobol::sample() scales to [0,1)
+uint32_t sobolUInt(unsigned long long index, unsigned dimension, unsigned scramble = 0U)
+{
+    unsigned result = scramble;
+    for (unsigned i = dimension * sobol::Matrices::size; index; index >>= 1, ++i)
+        if (index & 1)
+            result ^= sobol::Matrices::matrices[i];
+    return result;
+}
+
+} // namespace
+
 Sobol::Sobol(unsigned dimensions) : m_numDimensions(dimensions)
 {
     // empty
 }
 
-void Sobol::sample(float r[], unsigned i)
+void Sobol::sample(float r[], unsigned i) { Sobol::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void Sobol::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     if (m_scrambles.size() == dimensions())
     {
-        for (unsigned d = 0; d < dimensions(); ++d) r[d] = sobol::sample(i, d, m_scrambles[d]);
+        for (unsigned d = 0; d < dimensions(); ++d)
+            if (hasDimension(mask, d))
+                r[d] = sobol::sample(i, d, m_scrambles[d]);
     }
     else
     {
-        for (unsigned d = 0; d < dimensions(); ++d) r[d] = sobol::sample(i, d);
+        for (unsigned d = 0; d < dimensions(); ++d)
+            if (hasDimension(mask, d))
+                r[d] = sobol::sample(i, d);
     }
 }
 
+void Sobol::sampleRangeMasked(float points[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask)
+{
+    sampleRangeMaskedInline(*this, points, first, count, stride, mask);
+}
+
+void Sobol::sampleUInt(uint32_t r[], unsigned i)
+{
+    bool scrambled = m_scrambles.size() == dimensions();
+    for (unsigned d = 0; d < dimensions(); ++d) r[d] = sobolUInt(i, d, scrambled ? m_scrambles[d] : 0U);
+}
+
+void Sobol::sampleUIntRange(uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleUIntRangeInline(*this, points, first, count, stride);
+}
+
+void Sobol::sampleDouble(double r[], unsigned i) { sampleDoubleFromUInt(*this, r, i); }
+
+void Sobol::sampleDoubleRange(double points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleDoubleRangeInline(*this, points, first, count, stride);
+}
+
 void Sobol::setSeed(uint32_t seed)
 {
     m_seed = seed;
@@ -59,10 +103,36 @@ void ZeroTwo::reset()
 
 int ZeroTwo::setNumSamples(unsigned n) { return m_numSamples = (n == 0) ? 1 : n; }
 
-void ZeroTwo::sample(float r[], unsigned i)
+void ZeroTwo::sample(float r[], unsigned i) { ZeroTwo::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void ZeroTwo::sampleMasked(float r[], unsigned i, DimensionMask mask)
+{
+    for (unsigned d = 0; d < dimensions(); ++d)
+        if (hasDimension(mask, d))
+            r[d] = sobol::sample(permute(i, m_numSamples, m_permutes[d / 2]), d % 2, m_scrambles[d]);
+}
+
+void ZeroTwo::sampleRangeMasked(float points[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask)
+{
+    sampleRangeMaskedInline(*this, points, first, count, stride, mask);
+}
+
+void ZeroTwo::sampleUInt(uint32_t r[], unsigned i)
 {
     for (unsigned d = 0; d < dimensions(); ++d)
-        r[d] = sobol::sample(permute(i, m_numSamples, m_permutes[d / 2]), d % 2, m_scrambles[d]);
+        r[d] = sobolUInt(permute(i, m_numSamples, m_permutes[d / 2]), d % 2, m_scrambles[d]);
+}
+
+void ZeroTwo::sampleUIntRange(uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleUIntRangeInline(*this, points, first, count, stride);
+}
+
+void ZeroTwo::sampleDouble(double r[], unsigned i) { sampleDoubleFromUInt(*this, r, i); }
+
+void ZeroTwo::sampleDoubleRange(double points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleDoubleRangeInline(*this, points, first, count, stride);
 }
 
 SSobol::SSobol(unsigned dimensions) : m_numDimensions(dimensions)
@@ -70,10 +140,19 @@ SSobol::SSobol(unsigned dimensions) : m_numDimensions(dimensions)
     // empty
 }
 
-void SSobol::sample(float r[], unsigned i)
+void SSobol::sample(float r[], unsigned i) { SSobol::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void SSobol::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     for (unsigned d = 0; d < dimensions(); ++d)
-        r[d] = float(sampling::GetSobolStatelessIter(i, d % MAX_DIMENSION, mix_bits(m_seed + d / 2), 2));
+        if (hasDimension(mask, d))
+            r[d] = float(sampling::GetSobolStatelessIter(i, d % MAX_DIMENSION, mix_bits(m_seed + d / 2), 2));
+}
+
+void SSobol::sampleDouble(double r[], unsigned i)
+{
+    for (unsigned d = 0; d < dimensions(); ++d)
+        r[d] = sampling::GetSobolStatelessIter(i, d % MAX_DIMENSION, mix_bits(m_seed + d / 2), 2);
 }
 
 ZSobol::ZSobol(unsigned dimensions) : SSobol(dimensions)
@@ -125,7 +204,8 @@ uint64_t ZSobol::shuffled_morton_index(uint32_t morton_index, uint32_t num_base_
     return sample_index;
 }
 
-void ZSobol::sample(float r[], unsigned i)
+template <typename T>
+void ZSobol::samplePrecision(T r[], unsigned i, DimensionMask mask)
 {
     uint32_t pixel_x      = i / (1 << m_log2_res);
     uint32_t pixel_y      = i % (1 << m_log2_res);
@@ -133,8 +213,10 @@ void ZSobol::sample(float r[], unsigned i)
 
     for (unsigned d = 0; d < dimensions(); ++d)
     {
+        if (!hasDimension(mask, d))
+            continue;
         auto j = shuffled_morton_index(morton_index, m_num_base_4_digits, (d / 2) * 2);
-        r[d]   = float(sampling::GetSobolStatelessIter(j, d % MAX_DIMENSION, mix_bits(m_seed + d / 2), 2));
+        r[d]   = T(sampling::GetSobolStatelessIter(j, d % MAX_DIMENSION, mix_bits(m_seed + d / 2), 2));
         if (d == 0)
             r[0] = (pixel_x + r[0]) / (1 << m_log2_res);
         else if (d == 1)
@@ -142,6 +224,12 @@ void ZSobol::sample(float r[], unsigned i)
     }
 }
 
+void ZSobol::sample(float r[], unsigned i) { samplePrecision(r, i, ALL_DIMENSIONS); }
+
+void ZSobol::sampleMasked(float r[], unsigned i, DimensionMask mask) { samplePrecision(r, i, mask); }
+
+void ZSobol::sampleDouble(double r[], unsigned i) { samplePrecision(r, i, ALL_DIMENSIONS); }
+
 OneTwo::OneTwo(unsigned n, unsigned dimensions, uint32_t seed) :
     m_numSamples(n), m_numDimensions(dimensions), m_seed(seed)
 {
@@ -158,15 +246,42 @@ void OneTwo::reset()
 
 int OneTwo::setNumSamples(unsigned n) { return m_numSamples = (n == 0) ? 1 : n; }
 
-void OneTwo::sample(float r[], unsigned i)
+void OneTwo::sample(float r[], unsigned i) { OneTwo::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void OneTwo::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     for (unsigned d = 0; d < dimensions(); ++d)
     {
+        if (!hasDimension(mask, d))
+            continue;
         int pi = permute(i, m_numSamples, m_permutes[d / 2]);
         r[d]   = sample12(pi, d);
     }
 }
 
+void OneTwo::sampleRangeMasked(float points[], uint64_t first, unsigned count, unsigned stride, DimensionMask mask)
+{
+    sampleRangeMaskedInline(*this, points, first, count, stride, mask);
+}
+
+void OneTwo::sampleUInt(uint32_t r[], unsigned i)
+{
+    for (unsigned d = 0; d < dimensions(); ++d)
+        r[d] = onetwo_sample(d % onetwo_matrices_size, permute(i, m_numSamples, m_permutes[d / 2]));
+}
+
+void OneTwo::sampleUIntRange(uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleUIntRangeInline(*this, points, first, count, stride);
+}
+
+void OneTwo::sampleDouble(double r[], unsigned i) { sampleDoubleFromUInt(*this, r, i); }
+
+void OneTwo::sampleDoubleRange(double points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleDoubleRangeInline(*this, points, first, count, stride);
+}
+
 float OneTwo::sample12(const uint64_t index, const int dim) const
 {
     // auto     h = hash(m_seed, dim);
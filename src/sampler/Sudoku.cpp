@@ -16,13 +16,14 @@ SudokuInPlace::SudokuInPlace(unsigned x, unsigned y, unsigned dimensions, uint32
     setNumSamples(x, y);
 }
 
-void SudokuInPlace::sample(float r[], unsigned i)
+void SudokuInPlace::sample(float r[], unsigned i) { SudokuInPlace::sampleMasked(r, i, ALL_DIMENSIONS); }
+
+void SudokuInPlace::sampleMasked(float r[], unsigned i, DimensionMask mask)
 {
     if (i >= m_numSamples)
         i = 0;
 
-    if (i == 0)
-        m_rand.seed(m_seed);
+    seekPoint(m_rand, pcg32(m_seed), i, 2 * ((dimensions() + 1) / 2));
 
     // which digit of the sudoku puzzle we are considering
     unsigned digit = permute(i / m_numDigits, m_numDigits, m_permutation * 0x1fc195a7);
@@ -33,6 +34,13 @@ void SudokuInPlace::sample(float r[], unsigned i)
 
     for (unsigned d = 0; d < dimensions(); d += 2)
     {
+        bool useX = hasDimension(mask, d), useY = d + 1 < dimensions() && hasDimension(mask, d + 1);
+        if (!useX && !useY)
+        {
+            m_rand.advance(2); // skip the jitter of this pair of dimensions
+            continue;
+        }
+
         // make i specify the (possibly permuted) sample index within the digit
         int s = permute(i % m_numDigits, m_numDigits, m_permutation * (0x51633e2d * (d + 1) * (digit + 1)));
 
@@ -54,8 +62,9 @@ void SudokuInPlace::sample(float r[], unsigned i)
         float jx = 0.5f + m_maxJit * (m_rand.nextFloat() - 0.5f);
         float jy = 0.5f + m_maxJit * (m_rand.nextFloat() - 0.5f);
 
-        r[d] = (x + (sx + (ssx + jx) / m_numDigits) / m_resY) / m_resX;
-        if (d + 1 < dimensions())
+        if (useX)
+            r[d] = (x + (sx + (ssx + jx) / m_numDigits) / m_resY) / m_resX;
+        if (useY)
             r[d + 1] = (y + (sy + (ssy + jy) / m_numDigits) / m_resX) / m_resY;
     }
 }
@@ -15,6 +15,30 @@ void XiSequence::sample(float r[], unsigned i)
     r[1] = (*m_xi)[i].y * inv;
 }
 
+void XiSequence::sampleRange(float points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleRangeInline(*this, points, first, count, stride);
+}
+
+void XiSequence::sampleUInt(uint32_t r[], unsigned i)
+{
+    Point p = (*m_xi)[i];
+    r[0]    = p.x;
+    r[1]    = p.y;
+}
+
+void XiSequence::sampleUIntRange(uint32_t points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleUIntRangeInline(*this, points, first, count, stride);
+}
+
+void XiSequence::sampleDouble(double r[], unsigned i) { sampleDoubleFromUInt(*this, r, i); }
+
+void XiSequence::sampleDoubleRange(double points[], uint64_t first, unsigned count, unsigned stride)
+{
+    sampleDoubleRangeInline(*this, points, first, count, stride);
+}
+
 void XiSequence::setSeed(uint32_t seed)
 {
     m_rand.seed(seed);
@@ -0,0 +1,388 @@
+/** \file samplerbench.cpp
+    \author Wojciech Jarosz
+
+    Measures how long every sampler takes to set up and to generate points, over a grid of point counts and
+    dimensions, so that performance regressions between versions show up as changes in its JSON or CSV output.
+*/
+
+#include "batch.h"
+#include "common.h"
+#include "perf_counters.h"
+
+#include <sampler/Sampler.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fmt/format.h>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+//
+// Count every allocation, to report how much memory each sampler allocates while it is being measured
+//
+namespace
+{
+std::atomic<uint64_t> g_bytes_allocated{0};
+std::atomic<uint64_t> g_num_allocations{0};
+
+// the points are summed up into this, so that the compiler cannot optimize away generating them
+volatile double g_sink = 0.0;
+} // namespace
+
+void *operator new(size_t size)
+{
+    g_bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+    g_num_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/// Number of points generated with each call to Sampler::sampleRange()
+constexpr int64_t BLOCK_SIZE = 4096;
+
+struct BenchOptions
+{
+    string      filter;               ///< only measure samplers whose name contains this
+    int         min_log2_points = 4;  ///< measure 2^min_log2_points ...
+    int         max_log2_points = 24; ///< ... through 2^max_log2_points points
+    int         log2_step       = 2;  ///< in steps of this many powers of two
+    vector<int> dimensions      = {1, 2, 3, 4, 8, 16, 32, 64};
+    int         repeats         = 5;   ///< measure every configuration this many times
+    double      budget          = 2.0; ///< seconds to spend on a configuration before moving on
+    uint32_t    seed            = 0;
+    string      format          = "json"; ///< "json" or "csv"
+    string      output          = "-";
+};
+
+/// Timings of one configuration, over all repeats
+struct Measurement
+{
+    string         sampler;
+    int            dimensions       = 0;
+    int64_t        requested_points = 0;
+    int64_t        points           = 0; ///< the number of points after the sampler rounded the requested number
+    vector<double> setup;                ///< seconds spent in setNumSamples(), one per repeat
+    vector<double> sample;               ///< seconds spent generating all points, one per repeat
+    uint64_t       bytes_allocated  = 0; ///< during the first repeat
+    uint64_t       num_allocations  = 0; ///< during the first repeat
+    PerfCounts     counters;             ///< hardware counts while generating points, summed over all repeats
+};
+
+double seconds_since(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// The `p`-th percentile (0 to 100) of `values`, by the nearest-rank method
+double percentile(vector<double> values, double p)
+{
+    std::sort(values.begin(), values.end());
+    size_t rank = (size_t)std::ceil(p / 100.0 * values.size());
+    return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+}
+
+bool contains_ignoring_case(const string &haystack, const string &needle)
+{
+    return to_lower(haystack).find(to_lower(needle)) != string::npos;
+}
+
+/**
+    Measure `sampler` with `num_points` points of `dims` dimensions, generated in blocks with Sampler::sampleRange().
+
+    Returns false if the sampler cannot produce points at all (like an empty CSV file).
+*/
+bool measure(Sampler *sampler, unsigned dims, int64_t num_points, const BenchOptions &options, PerfCounters &counters,
+             Measurement &m)
+{
+    vector<float> block(size_t(BLOCK_SIZE) * dims);
+    double        sum   = 0.0;
+    auto          begin = Clock::now();
+    // don't count growing these as allocations by the sampler
+    m.setup.reserve(options.repeats);
+    m.sample.reserve(options.repeats);
+    for (int r = 0; r < options.repeats; ++r)
+    {
+        uint64_t bytes       = g_bytes_allocated.load();
+        uint64_t allocations = g_num_allocations.load();
+
+        auto start  = Clock::now();
+        int  points = sampler->setNumSamples((unsigned)num_points);
+        m.setup.push_back(seconds_since(start));
+
+        m.points = points < 0 ? num_points : points;
+        if (m.points == 0)
+            return false;
+
+        start = Clock::now();
+        counters.start();
+        for (int64_t i = 0; i < m.points; i += BLOCK_SIZE)
+        {
+            unsigned count = (unsigned)std::min<int64_t>(BLOCK_SIZE, m.points - i);
+            sampler->sampleRange(block.data(), i, count, dims);
+            sum += block[size_t(count - 1) * dims];
+        }
+        m.counters += counters.stop();
+        m.sample.push_back(seconds_since(start));
+
+        if (r == 0)
+        {
+            m.bytes_allocated = g_bytes_allocated.load() - bytes;
+            m.num_allocations = g_num_allocations.load() - allocations;
+        }
+
+        // slow configurations are measured fewer times, but always at least once
+        if (seconds_since(begin) > options.budget)
+            break;
+    }
+
+    g_sink = g_sink + sum;
+    return true;
+}
+
+vector<Measurement> run_benchmarks(const BenchOptions &options)
+{
+    vector<Measurement> results;
+    PerfCounters        counters;
+    if (!counters.available())
+        fmt::print(stderr, "Not measuring hardware counters: {}\n", counters.error());
+
+    for (int index = 0;; ++index)
+    {
+        std::unique_ptr<Sampler> sampler(create_sampler(index, 2, 0.8f));
+        if (!sampler)
+            break;
+        if (!contains_ignoring_case(sampler->name(), options.filter))
+            continue;
+
+        for (int dims : options.dimensions)
+        {
+            if (unsigned(dims) < sampler->minDimensions() || unsigned(dims) > sampler->maxDimensions())
+                continue;
+
+            // start each dimensionality from a freshly constructed sampler, like the viewer does
+            sampler.reset(create_sampler(index, dims, 0.8f));
+            sampler->setDimensions(dims);
+            if (sampler->seed() != options.seed)
+                sampler->setSeed(options.seed);
+
+            for (int k = options.min_log2_points; k <= options.max_log2_points; k += options.log2_step)
+            {
+                Measurement m;
+                m.sampler          = sampler->name();
+                m.dimensions       = dims;
+                m.requested_points = int64_t(1) << k;
+                fmt::print(stderr, "{} with {} dimensions and 2^{} points...", m.sampler, dims, k);
+                auto start = Clock::now();
+                if (!measure(sampler.get(), dims, m.requested_points, options, counters, m))
+                {
+                    fmt::print(stderr, " produces no points, skipping\n");
+                    break;
+                }
+                fmt::print(stderr, " {:.3f} s\n", seconds_since(start));
+                results.push_back(std::move(m));
+
+                // larger point sets would only take longer
+                if (results.back().setup[0] + results.back().sample[0] > options.budget)
+                {
+                    fmt::print(stderr, "Exceeded the budget of {} s, skipping larger point sets\n", options.budget);
+                    break;
+                }
+            }
+        }
+    }
+    return results;
+}
+
+/// `count` per generated point of `m`, or `missing` if it was not measured
+string per_point(const std::optional<uint64_t> &count, const Measurement &m, const char *missing)
+{
+    return count ? fmt::format("{:.6g}", double(*count) / (m.points * m.sample.size())) : missing;
+}
+
+void write_results(const vector<Measurement> &results, const BenchOptions &options)
+{
+    FILE *out = options.output == "-" ? stdout : std::fopen(options.output.c_str(), "w");
+    if (!out)
+        throw std::runtime_error(fmt::format("Cannot write to \"{}\"", options.output));
+
+    if (options.format == "csv")
+        fmt::print(out, "sampler,dimensions,requested_points,points,repeats,setup_p10,setup_median,setup_p90,"
+                        "sample_p10,sample_median,sample_p90,points_per_second,bytes_allocated,allocations,cycles_per_point,"
+                        "instructions_per_point,cache_misses_per_point,branch_misses_per_point\n");
+    else
+        fmt::print(out, "{{\n  \"version\": \"{}\",\n  \"build_time\": \"{}\",\n  \"results\": [", git_describe(),
+                   build_timestamp());
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        auto  &m                 = results[i];
+        double sample_median     = percentile(m.sample, 50);
+        double points_per_second = sample_median > 0.0 ? m.points / sample_median : 0.0;
+        if (options.format == "csv")
+            fmt::print(out, "\"{}\",{},{},{},{},{:.9g},{:.9g},{:.9g},{:.9g},{:.9g},{:.9g},{:.6g},{},{},{},{},{},{}\n",
+                       m.sampler, m.dimensions, m.requested_points, m.points, m.sample.size(), percentile(m.setup, 10),
+                       percentile(m.setup, 50), percentile(m.setup, 90), percentile(m.sample, 10), sample_median,
+                       percentile(m.sample, 90), points_per_second, m.bytes_allocated, m.num_allocations,
+                       per_point(m.counters.cycles, m, ""), per_point(m.counters.instructions, m, ""),
+                       per_point(m.counters.cache_misses, m, ""), per_point(m.counters.branch_misses, m, ""));
+        else
+            fmt::print(out,
+                       "{}\n    {{\"sampler\": \"{}\", \"dimensions\": {}, \"requested_points\": {}, \"points\": {}, "
+                       "\"repeats\": {}, \"setup_seconds\": {{\"p10\": {:.9g}, \"median\": {:.9g}, \"p90\": {:.9g}}}, "
+                       "\"sample_seconds\": {{\"p10\": {:.9g}, \"median\": {:.9g}, \"p90\": {:.9g}}}, "
+                       "\"points_per_second\": {:.6g}, \"bytes_allocated\": {}, \"allocations\": {}, "
+                       "\"per_point\": {{\"cycles\": {}, \"instructions\": {}, \"cache_misses\": {}, "
+                       "\"branch_misses\": {}}}}}",
+                       i ? "," : "", m.sampler, m.dimensions, m.requested_points, m.points, m.sample.size(),
+                       percentile(m.setup, 10), percentile(m.setup, 50), percentile(m.setup, 90),
+                       percentile(m.sample, 10), sample_median, percentile(m.sample, 90), points_per_second,
+                       m.bytes_allocated, m.num_allocations, per_point(m.counters.cycles, m, "null"),
+                       per_point(m.counters.instructions, m, "null"), per_point(m.counters.cache_misses, m, "null"),
+                       per_point(m.counters.branch_misses, m, "null"));
+    }
+
+    if (options.format != "csv")
+        fmt::print(out, "\n  ]\n}}\n");
+    if (out != stdout)
+        std::fclose(out);
+}
+
+vector<int> parse_list(const string &list)
+{
+    vector<int> values;
+    for (size_t start = 0; start <= list.size();)
+    {
+        size_t comma = std::min(list.find(',', start), list.size());
+        values.push_back(std::stoi(list.substr(start, comma - start)));
+        start = comma + 1;
+    }
+    return values;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    BenchOptions options;
+    bool         help  = false;
+    bool         error = false;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            auto value = [&]() -> string
+            {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument(fmt::format("Missing value for \"{}\"", argv[i]));
+                return argv[++i];
+            };
+            auto is = [&](const char *short_name, const char *long_name)
+            { return (short_name && strcmp(short_name, argv[i]) == 0) || strcmp(long_name, argv[i]) == 0; };
+
+            if (is("-h", "--help"))
+                help = true;
+            else if (is("-s", "--sampler"))
+                options.filter = value();
+            else if (is("-n", "--log2-points"))
+            {
+                auto range = parse_list(value());
+                if (range.size() < 2 || range.size() > 3)
+                    throw std::invalid_argument("Expected MIN,MAX[,STEP] for --log2-points");
+                options.min_log2_points = range[0];
+                options.max_log2_points = range[1];
+                options.log2_step       = range.size() > 2 ? range[2] : 1;
+                if (options.min_log2_points < 0 || options.max_log2_points > 31 || options.log2_step < 1)
+                    throw std::invalid_argument("Invalid range of point counts");
+            }
+            else if (is("-d", "--dimensions"))
+            {
+                options.dimensions = parse_list(value());
+                if (*std::min_element(options.dimensions.begin(), options.dimensions.end()) < 1)
+                    throw std::invalid_argument("The dimensions must be positive");
+            }
+            else if (is("-r", "--repeats"))
+                options.repeats = std::max(1, std::stoi(value()));
+            else if (is("-b", "--budget"))
+                options.budget = std::stod(value());
+            else if (is(nullptr, "--seed"))
+                options.seed = (uint32_t)std::stoul(value());
+            else if (is("-f", "--format"))
+            {
+                options.format = value();
+                if (options.format != "json" && options.format != "csv")
+                    throw std::invalid_argument(fmt::format("Unknown output format \"{}\"", options.format));
+            }
+            else if (is("-o", "--output"))
+                options.output = value();
+            else
+                throw std::invalid_argument(fmt::format("Unknown argument \"{}\"", argv[i]));
+        }
+    }
+    catch (const std::exception &e)
+    {
+        fmt::print(stderr, "Error: {}\n", e.what());
+        help  = true;
+        error = true;
+    }
+    if (help)
+    {
+        fmt::print(error ? stderr : stdout, R"(Syntax: {} [options]
+Measure how fast every sampler sets up and generates points.
+Options:
+   -h, --help                Display this message
+   -s, --sampler TEXT        Only measure samplers whose name contains TEXT, ignoring case
+   -n, --log2-points MIN,MAX[,STEP]
+                             Measure 2^MIN through 2^MAX points, in steps of 2^STEP (default 4,24,2)
+   -d, --dimensions LIST     Comma-separated dimensions to measure (default 1,2,3,4,8,16,32,64)
+   -r, --repeats R           Number of times each configuration is measured (default 5)
+   -b, --budget SECONDS      Stop repeating a configuration after this long, and skip larger point sets once a
+                             single run takes this long (default 2)
+   --seed S                  Seed used to randomize the points (default 0)
+   -f, --format FORMAT       Output format: json (default) or csv
+   -o, --output FILE         Write the results to FILE instead of the standard output
+)",
+                   argv[0]);
+        return error ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    try
+    {
+        write_results(run_benchmarks(options), options);
+    }
+    catch (const std::exception &e)
+    {
+        fmt::print(stderr, "Error: {}\n", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
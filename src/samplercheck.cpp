@@ -0,0 +1,475 @@
+/** \file samplercheck.cpp
+    \author Wojciech Jarosz
+
+    Checks that every sampler still produces bit-for-bit the same points. For each sampler and a matrix of settings,
+    the points from the plain, sequential Sampler::sample() loop are compared with every other way of generating them
+    (in reverse order, with 64-bit indices, in blocks, on several threads, through the batch writer, and as merged
+    shards), and their checksum is compared with the digest recorded by an earlier run (see
+    resources/sampler_digests.txt); a configuration without a recorded digest fails the check. The fixed-point and
+    double-precision coordinates of Sampler::sampleUInt() and Sampler::sampleDouble() have to agree with the float ones
+    up to the precision of a float, and the dimensions computed on their own with Sampler::sampleRangeMasked() have to
+    be exactly the same.
+*/
+
+#include "batch.h"
+#include "common.h"
+
+#include <sampler/MappedFile.h>
+#include <sampler/OA.h>
+#include <sampler/PointFile.h>
+#include <sampler/Sampler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifndef SAMPLERCHECK_DIGESTS
+#define SAMPLERCHECK_DIGESTS "sampler_digests.txt"
+#endif
+
+using std::string;
+using std::vector;
+namespace fs = std::filesystem;
+
+namespace
+{
+
+/// One combination of settings to check
+struct Config
+{
+    int      index;            ///< of the sampler, for create_sampler()
+    string   sampler;          ///< its name
+    int64_t  num_points;       ///< requested number of points, before the sampler rounds it
+    int      dimensions;
+    uint32_t seed;
+    float    jitter;           ///< in percent; negative for the sampler's default
+    int      offset_type = -1; ///< of orthogonal arrays; negative for the default
+
+    /// Identifies the configuration in the digest file
+    string key() const
+    {
+        return fmt::format("{}; n={}; d={}; seed={}; jitter={}; offset={}", sampler, num_points, dimensions, seed,
+                           jitter, offset_type);
+    }
+
+    BatchOptions options() const
+    {
+        BatchOptions o;
+        o.sampler        = sampler;
+        o.num_points     = num_points;
+        o.num_dimensions = dimensions;
+        o.seed           = seed;
+        o.jitter         = jitter;
+        if (offset_type >= 0)
+            o.offset_type = std::to_string(offset_type);
+        return o;
+    }
+};
+
+/// A sampler configured like `c`, along with its number of points
+std::unique_ptr<Sampler> make_sampler(const Config &c, int64_t &num_points)
+{
+    std::unique_ptr<Sampler> sampler(create_sampler(c.index, c.dimensions, 0.8f));
+    num_points = configure_sampler(sampler.get(), c.options());
+    return sampler;
+}
+
+/// Generate `num_points` points of `dims` dimensions with `sample(point, i)`, visiting the indices in the order given
+/// by `order(k)`
+template <typename Sample, typename Order>
+vector<float> generate(int64_t num_points, int dims, Sample &&sample, Order &&order)
+{
+    vector<float> points(size_t(num_points) * dims, 0.5f);
+    for (int64_t k = 0; k < num_points; ++k)
+    {
+        int64_t i = order(k, num_points);
+        sample(&points[size_t(i) * dims], i);
+    }
+    return points;
+}
+
+/// Generate the points in uneven blocks with Sampler::sampleRange(), one float further apart than needed; the padding
+/// has to be left untouched
+vector<float> range_points(Sampler *sampler, int64_t num_points, int dims)
+{
+    constexpr int BLOCK = 37;
+
+    int           stride = dims + 1;
+    vector<float> padded(size_t(num_points) * stride, 0.5f), points;
+    for (int64_t i = 0; i < num_points; i += BLOCK)
+        sampler->sampleRange(&padded[size_t(i) * stride], i, (unsigned)std::min<int64_t>(BLOCK, num_points - i),
+                             stride);
+
+    points.reserve(size_t(num_points) * dims);
+    for (int64_t i = 0; i < num_points; ++i)
+    {
+        const float *point = &padded[size_t(i) * stride];
+        if (point[dims] != 0.5f)
+            return {};
+        points.insert(points.end(), point, point + dims);
+    }
+    return points;
+}
+
+/// Check that the fixed-point (`T` = uint32_t) or double-precision (`T` = double) ranges of points, generated in
+/// uneven, padded blocks like range_points(), are the same as the points generated one by one, and that these match
+/// the float coordinates of `reference`. Returns what is wrong, if anything.
+template <typename T>
+string check_precise(Sampler *sampler, int64_t num_points, int dims, const vector<float> &reference)
+{
+    constexpr bool   fixed     = std::is_same_v<T, uint32_t>;
+    constexpr int    BLOCK     = 37;
+    constexpr T      PADDING   = fixed ? T(0x80000000u) : T(0.5);
+    constexpr double TOLERANCE = 0x1p-20; // floats only keep 24 bits of the coordinates
+    const char      *name      = fixed ? "sampleUInt" : "sampleDouble";
+
+    int       stride = dims + 1;
+    vector<T> padded(size_t(num_points) * stride, PADDING), point(dims);
+    for (int64_t i = 0; i < num_points; i += BLOCK)
+    {
+        unsigned count = (unsigned)std::min<int64_t>(BLOCK, num_points - i);
+        if constexpr (fixed)
+            sampler->sampleUIntRange(&padded[size_t(i) * stride], i, count, stride);
+        else
+            sampler->sampleDoubleRange(&padded[size_t(i) * stride], i, count, stride);
+    }
+
+    for (int64_t i = 0; i < num_points; ++i)
+    {
+        const T *range = &padded[size_t(i) * stride];
+        if constexpr (fixed)
+            sampler->sampleUInt(point.data(), (unsigned)i);
+        else
+            sampler->sampleDouble(point.data(), (unsigned)i);
+        if (range[dims] != PADDING || !std::equal(point.begin(), point.end(), range))
+            return fmt::format("the {}Range points differ from the {} ones", name, name);
+
+        for (int d = 0; d < dims; ++d)
+        {
+            double precise = fixed ? point[d] * 0x1p-32 : point[d], single = reference[size_t(i) * dims + d];
+            if (std::abs(precise - single) > TOLERANCE)
+                return fmt::format("coordinate {} of point {} is {} with {}, but {} as a float", d, i, precise, name,
+                                   single);
+        }
+    }
+    return {};
+}
+
+/// Check that the dimensions selected by a few masks, generated in uneven blocks with Sampler::sampleRangeMasked(),
+/// are the same as those of `reference`, and that the others are left untouched (at the 0.5 that generate() starts
+/// from) or have their usual values. Returns what is wrong, if anything.
+string check_masked(Sampler *sampler, int64_t num_points, int dims, const vector<float> &reference)
+{
+    constexpr int   BLOCK     = 37;
+    constexpr float UNTOUCHED = 0.5f;
+
+    // the odd dimensions, the last one alone, and everything but the first one
+    for (DimensionMask mask : {DimensionMask(0xaaaaaaaaaaaaaaaa), DimensionMask(1) << (dims - 1), ALL_DIMENSIONS - 1})
+    {
+        vector<float> points(size_t(num_points) * dims, UNTOUCHED);
+        for (int64_t i = 0; i < num_points; i += BLOCK)
+            sampler->sampleRangeMasked(&points[size_t(i) * dims], i, (unsigned)std::min<int64_t>(BLOCK, num_points - i),
+                                       dims, mask);
+
+        for (size_t k = 0; k < points.size(); ++k)
+        {
+            int d = int(k % dims);
+            if (points[k] != reference[k] && (hasDimension(mask, d) || points[k] != UNTOUCHED))
+                return fmt::format("coordinate {} of point {} differs with the dimension mask {:x}", d, k / dims, mask);
+        }
+    }
+    return {};
+}
+
+/// Several threads, each with its own sampler, generate interleaved blocks of points
+vector<float> threaded_points(const Config &c, int64_t num_points)
+{
+    constexpr int NUM_THREADS = 3, BLOCK = 37;
+
+    vector<float>       points(size_t(num_points) * c.dimensions, 0.5f);
+    vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t)
+        threads.emplace_back(
+            [&, t]()
+            {
+                int64_t n;
+                auto    sampler = make_sampler(c, n);
+                for (int64_t b = t * BLOCK; b < n; b += NUM_THREADS * BLOCK)
+                    for (int64_t i = b; i < std::min(b + BLOCK, n); ++i)
+                        sampler->sample(&points[size_t(i) * c.dimensions], (unsigned)i);
+            });
+    for (auto &thread : threads) thread.join();
+    return points;
+}
+
+/// The points in the .pts file `filename`
+vector<float> read_points(const string &filename)
+{
+    MappedFile    file(filename);
+    auto          data = file.view();
+    PointFileInfo info;
+    if (!parsePointFileHeader(data, info))
+        throw std::runtime_error(fmt::format("\"{}\" is not a point file", filename));
+    data.remove_prefix(info.dataOffset);
+    vector<float> points(data.size() / sizeof(float));
+    std::memcpy(points.data(), data.data(), points.size() * sizeof(float));
+    return points;
+}
+
+/// Write the points with run_batch(), in `num_shards` shards merged with merge_shards() unless it is 0
+vector<float> batch_points(const Config &c, int num_shards, const fs::path &dir)
+{
+    auto options   = c.options();
+    options.format = "pts";
+    string output  = (dir / "all.pts").string();
+    if (!num_shards)
+    {
+        options.output = output;
+        run_batch(options);
+        return read_points(output);
+    }
+
+    vector<string> shards;
+    options.num_shards = num_shards;
+    for (int k = 0; k < num_shards; ++k)
+    {
+        options.shard  = k;
+        options.output = (dir / fmt::format("shard{}.pts", k)).string();
+        run_batch(options);
+        shards.push_back(options.output);
+    }
+    string merged = (dir / "merged.pts").string();
+    merge_shards(merged, shards);
+    return read_points(merged);
+}
+
+uint64_t checksum(const vector<float> &points)
+{
+    return point_checksum(std::string_view((const char *)points.data(), points.size() * sizeof(float)));
+}
+
+/// All configurations to check for the samplers whose name contains `filter`
+vector<Config> configs(const string &filter)
+{
+    vector<Config> configs;
+    for (int index = 0;; ++index)
+    {
+        std::unique_ptr<Sampler> sampler(create_sampler(index, 2, 0.8f));
+        if (!sampler)
+            break;
+        string name = sampler->name();
+        if (to_lower(name).find(to_lower(filter)) == string::npos)
+            continue;
+
+        int num_offset_types = 0;
+        if (auto oa = dynamic_cast<OrthogonalArray *>(sampler.get()))
+            num_offset_types = (int)oa->offsetTypeNames().size();
+
+        for (int dims : {2, 3, 7})
+        {
+            if (unsigned(dims) < sampler->minDimensions() || unsigned(dims) > sampler->maxDimensions())
+                continue;
+            for (int64_t n : {16, 100, 1024})
+                for (uint32_t seed : {0u, 7u})
+                    for (float jitter : {-1.f, 0.f})
+                        for (int offset = num_offset_types ? 0 : -1; offset < num_offset_types; ++offset)
+                            configs.push_back({index, name, n, dims, seed, jitter, offset});
+        }
+
+        // enough points to span several blocks of the batch writer
+        unsigned dims = std::clamp(2u, sampler->minDimensions(), sampler->maxDimensions());
+        configs.push_back({index, name, 150000, (int)dims, 3u, -1.f, -1});
+    }
+    return configs;
+}
+
+std::map<string, uint64_t> read_digests(const string &filename)
+{
+    std::map<string, uint64_t> digests;
+    std::ifstream              in(filename);
+    string                     line;
+    while (std::getline(in, line))
+    {
+        auto tab = line.rfind('\t');
+        if (line.empty() || line[0] == '#' || tab == string::npos)
+            continue;
+        digests[line.substr(0, tab)] = std::stoull(line.substr(tab + 1), nullptr, 16);
+    }
+    return digests;
+}
+
+void write_digests(const string &filename, const std::map<string, uint64_t> &digests)
+{
+    std::ofstream out(filename);
+    if (!out)
+        throw std::runtime_error(fmt::format("Cannot write to \"{}\"", filename));
+    out << "# FNV-1a checksums of the points of each sampler configuration, written by samplercheck --update\n";
+    for (auto &[key, digest] : digests) out << fmt::format("{}\t{:016x}\n", key, digest);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    string filter;
+    string digest_file = SAMPLERCHECK_DIGESTS;
+    bool   update      = false;
+    bool   help        = false;
+    bool   error       = false;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            auto value = [&]() -> string
+            {
+                if (i + 1 >= argc)
+                    throw std::invalid_argument(fmt::format("Missing value for \"{}\"", argv[i]));
+                return argv[++i];
+            };
+            auto is = [&](const char *short_name, const char *long_name)
+            { return (short_name && strcmp(short_name, argv[i]) == 0) || strcmp(long_name, argv[i]) == 0; };
+
+            if (is("-h", "--help"))
+                help = true;
+            else if (is("-s", "--sampler"))
+                filter = value();
+            else if (is("-g", "--digests"))
+                digest_file = value();
+            else if (is("-u", "--update"))
+                update = true;
+            else
+                throw std::invalid_argument(fmt::format("Unknown argument \"{}\"", argv[i]));
+        }
+    }
+    catch (const std::exception &e)
+    {
+        fmt::print(stderr, "Error: {}\n", e.what());
+        help  = true;
+        error = true;
+    }
+    if (help)
+    {
+        fmt::print(error ? stderr : stdout, R"(Syntax: {} [options]
+Check that every way of generating the points of each sampler gives bit-for-bit the same result, and that the result
+matches the digest recorded earlier. Configurations without a recorded digest count as failures.
+Options:
+   -h, --help                Display this message
+   -s, --sampler TEXT        Only check samplers whose name contains TEXT, ignoring case
+   -g, --digests FILE        The recorded digests (default {})
+   -u, --update              Record the digests of all checked configurations in the digest file, instead of comparing
+                             against it. Only do this after verifying that the points are meant to change.
+)",
+                   argv[0], SAMPLERCHECK_DIGESTS);
+        return error ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    auto start   = std::chrono::steady_clock::now();
+    auto digests = read_digests(digest_file);
+    auto dir     = fs::temp_directory_path() / fmt::format("samplercheck-{}", std::chrono::steady_clock::now()
+                                                                                   .time_since_epoch()
+                                                                                   .count());
+    fs::create_directories(dir);
+
+    int num_configs = 0, num_failures = 0, num_unrecorded = 0;
+    for (auto &c : configs(filter))
+    {
+        auto key  = c.key();
+        auto fail = [&](const string &message)
+        {
+            fmt::print(stderr, "FAILED {}: {}\n", key, message);
+            ++num_failures;
+        };
+
+        try
+        {
+            int64_t n;
+            auto    sampler   = make_sampler(c, n);
+            auto    sequence  = [](int64_t k, int64_t) { return k; };
+            auto    reference = generate(
+                n, c.dimensions, [&](float *p, int64_t i) { sampler->sample(p, (unsigned)i); }, sequence);
+            if (reference.empty())
+                continue; // e.g. a CSV file sampler without a file
+            ++num_configs;
+
+            // the viewer counts on this to tell how many points to expect before it sets up the sampler
+            int rounded = sampler->roundNumSamples(unsigned(c.num_points));
+            if (rounded > 0 ? rounded != n : rounded < 0 && sampler->numSamples() >= 0)
+                fail(fmt::format("roundNumSamples() gives {} points instead of {}", rounded, n));
+
+            // every other path has to reproduce the plain sequential loop exactly; the first three reuse the same
+            // sampler, so they also catch any state left behind by generating points earlier
+            std::pair<const char *, std::function<vector<float>()>> paths[] = {
+                {"reverse order",
+                 [&]
+                 {
+                     return generate(
+                         n, c.dimensions, [&](float *p, int64_t i) { sampler->sample(p, (unsigned)i); },
+                         [](int64_t k, int64_t count) { return count - 1 - k; });
+                 }},
+                {"64-bit indices",
+                 [&]
+                 {
+                     return generate(
+                         n, c.dimensions, [&](float *p, int64_t i) { sampler->sample64(p, (uint64_t)i); }, sequence);
+                 }},
+                {"sampleRange", [&] { return range_points(sampler.get(), n, c.dimensions); }},
+                {"threaded", [&] { return threaded_points(c, n); }},
+                {"batch", [&] { return batch_points(c, 0, dir); }},
+                {"sharded", [&] { return batch_points(c, 3, dir); }},
+            };
+            for (auto &[name, path] : paths)
+                if (path() != reference)
+                    fail(fmt::format("the {} points differ from the sequential ones", name));
+            for (auto error : {check_precise<uint32_t>(sampler.get(), n, c.dimensions, reference),
+                               check_precise<double>(sampler.get(), n, c.dimensions, reference),
+                               check_masked(sampler.get(), n, c.dimensions, reference)})
+                if (!error.empty())
+                    fail(error);
+
+            uint64_t digest = checksum(reference);
+            if (update)
+                digests[key] = digest;
+            else if (auto it = digests.find(key); it == digests.end())
+            {
+                // without a recorded digest nothing guards these points against changing, so that counts as an error
+                fmt::print(stderr, "UNRECORDED {}: no digest in \"{}\"\n", key, digest_file);
+                ++num_unrecorded;
+            }
+            else if (it->second != digest)
+                fail(fmt::format("the points changed (digest {:016x} instead of {:016x})", digest, it->second));
+        }
+        catch (const std::exception &e)
+        {
+            fail(e.what());
+        }
+    }
+
+    std::error_code ec;
+    fs::remove_all(dir, ec);
+
+    if (update)
+        write_digests(digest_file, digests);
+
+    fmt::print("Checked {} configurations in {:.1f} s: {} failed", num_configs,
+               std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), num_failures);
+    if (update)
+        fmt::print(", recorded their digests in \"{}\"", digest_file);
+    else if (num_unrecorded)
+        fmt::print(", {} have no recorded digest (run with --update to record them)", num_unrecorded);
+    fmt::print("\n");
+    return num_failures || num_unrecorded ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -9,6 +9,7 @@
 #define GL_HALF_FLOAT 0x140B
 #endif
 
+#include <algorithm>
 #include <fmt/core.h>
 
 using std::string;
@@ -348,6 +349,7 @@ void Shader::set_buffer(const std::string &name, VariableType dtype, size_t ndim
         GLenum buf_type = (name == "indices") ? GL_ELEMENT_ARRAY_BUFFER : GL_ARRAY_BUFFER;
         CHK(glBindBuffer(buf_type, buffer_id));
         CHK(glBufferData(buf_type, size, data, GL_DYNAMIC_DRAW));
+        buf.capacity = size;
     }
 
     buf.dtype = dtype;
@@ -356,6 +358,47 @@ void Shader::set_buffer(const std::string &name, VariableType dtype, size_t ndim
     buf.dirty = true;
 }
 
+void Shader::update_buffer(const std::string &name, VariableType dtype, size_t ndim, const size_t *shape,
+                           const void *data, size_t first)
+{
+    auto it = m_buffers.find(name);
+    if (it == m_buffers.end())
+        throw std::runtime_error("Shader::update_buffer(): could not find argument named \"" + name + "\"");
+
+    Buffer &buf = it->second;
+    if (buf.type != VertexBuffer || !buf.buffer)
+        return set_buffer(name, dtype, ndim, shape, data);
+
+    bool mismatch = ndim != buf.ndim || dtype != buf.dtype;
+    for (size_t i = 1; i < ndim; ++i)
+        mismatch |= shape[i] != buf.shape[i];
+    if (mismatch)
+        return set_buffer(name, dtype, ndim, shape, data); // reports the mismatch
+
+    size_t row_size = type_size(dtype);
+    for (size_t i = 1; i < ndim; ++i)
+        row_size *= shape[i];
+    size_t size = row_size * shape[0];
+
+    // only rows that were uploaded before can be kept
+    size_t offset = std::min(first, buf.shape[0]) * row_size;
+
+    CHK(glBindBuffer(GL_ARRAY_BUFFER, (GLuint)((uintptr_t)buf.buffer)));
+    if (size > buf.capacity)
+    {
+        buf.capacity = std::max(size, 2 * buf.capacity);
+        CHK(glBufferData(GL_ARRAY_BUFFER, buf.capacity, nullptr, GL_DYNAMIC_DRAW));
+        offset = 0;
+    }
+    if (size > offset)
+        CHK(glBufferSubData(GL_ARRAY_BUFFER, offset, size - offset, (const uint8_t *)data + offset));
+
+    for (size_t i = 0; i < 3; ++i)
+        buf.shape[i] = i < ndim ? shape[i] : 1;
+    buf.size  = size;
+    buf.dirty = true;
+}
+
 // void Shader::set_texture(const std::string &name, Texture *texture)
 // {
 //     auto it = m_buffers.find(name);
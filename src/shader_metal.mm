@@ -260,6 +260,13 @@ void Shader::set_buffer(const std::string &name, VariableType dtype, size_t ndim
     buf.size  = size;
 }
 
+void Shader::update_buffer(const std::string &name, VariableType dtype, size_t ndim, const size_t *shape,
+                           const void *data, size_t first)
+{
+    // buffers are blitted in one piece on Metal
+    set_buffer(name, dtype, ndim, shape, data);
+}
+
 // void Shader::set_texture(const std::string &name, Texture *texture)
 // {
 //     auto it = m_buffers.find(name);